@@ -0,0 +1,104 @@
+// Title:   Header file for Fast Fourier Transform
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef FAST_FOURIER_TRANSFORM_H
+#define FAST_FOURIER_TRANSFORM_H
+
+
+#include <cstdint>
+#include <cstddef>
+#include <complex>
+#include <vector>
+
+
+// Both transforms work in place on sizes, which are powers of two: the forward one splits the sequence
+// by halves (decimation in frequency) and leaves the result in bit-reversed order, which the inverse one
+// (decimation in time) takes back, so no reordering pass is needed for convolutions; two levels are
+// done at once (radix 4), with one radix-2 level first, if the number of levels is odd
+
+
+// --------------------------
+// Number-Theoretic Transform
+// --------------------------
+
+// Transform over integers modulo a prime p = c * 2^k + 1, which has roots of unity of every order up to 2^k,
+// so it's exact; values are kept in Montgomery form inside, which replaces divisions by p with multiplications,
+// and the roots of every size up to 2^maxLogSize are computed once by the constructor
+class NumberTheoreticTransform {
+private:
+	uint32_t modulus;
+	uint32_t negativeInverse;   // -1/p modulo 2^32
+	uint32_t rSquared;          // 2^64 modulo p, which brings values into Montgomery form
+	int largestLogSize;         // Sizes of up to 2^largestLogSize are supported by the roots
+	std::vector<uint32_t> roots;          // roots[size + j] = w^j, where w is a primitive root of the size, j < 3/4 size
+	std::vector<uint32_t> inverseRoots;   // Same for 1/w
+
+	uint32_t toMontgomery(uint32_t value) const;
+	uint32_t fromMontgomery(uint32_t value) const;
+	void forwardMontgomery(uint32_t* values, int logSize) const;
+	void inverseMontgomery(uint32_t* values, int logSize) const;   // Without the division by the size
+
+public:
+	// Note: the prime must be below 2^30; if 2^maxLogSize doesn't divide p - 1, the biggest size
+	// is reduced to the biggest power of two that does, as there are no roots of bigger orders
+	NumberTheoreticTransform(int maxLogSize, uint32_t primeModulus = 998244353, uint32_t primitiveRoot = 3);
+
+	uint32_t prime() const { return modulus; }
+	int maxLogSize() const { return largestLogSize; }
+
+	// Both return false and leave the values as they are, if their number isn't a power of two up to 2^maxLogSize()
+	bool forward(std::vector<uint32_t>& values) const;   // Values below p, result in bit-reversed order
+	bool inverse(std::vector<uint32_t>& values) const;   // Values in bit-reversed order, result in natural order
+
+	// Coefficients of the product of two polynomials modulo p, each coefficient being below p;
+	// empty if the product has more than 2^maxLogSize() coefficients
+	std::vector<uint32_t> multiply(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b) const;
+};
+
+
+// ----------------------
+// Fast Fourier Transform
+// ----------------------
+
+// Transform over complex numbers of double precision, whose roots are computed directly by cos() and sin()
+// for every size up to 2^maxLogSize, so their errors don't accumulate
+class FastFourierTransform {
+private:
+	std::vector<std::complex<double>> roots;          // roots[size + j] = exp(-2 pi i j / size), j < 3/4 size
+	std::vector<std::complex<double>> inverseRoots;   // Same for exp(2 pi i j / size)
+	int largestLogSize;
+
+public:
+	explicit FastFourierTransform(int maxLogSize);
+
+	int maxLogSize() const { return largestLogSize; }
+
+	// Both return false and leave the values as they are, if their number isn't a power of two up to 2^maxLogSize()
+	bool forward(std::vector<std::complex<double>>& values) const;   // Result in bit-reversed order
+	bool inverse(std::vector<std::complex<double>>& values) const;   // Values in bit-reversed order
+
+	// Coefficients of the product of two polynomials, with rounding errors of the order of 1e-16 of the biggest one;
+	// empty if the product has more than 2^maxLogSize() coefficients
+	std::vector<double> multiply(const std::vector<double>& a, const std::vector<double>& b) const;
+};
+
+
+// ------------
+// Big Integers
+// ------------
+
+// Products of non-negative integers given by 64-bit limbs from the lowest one; both split the limbs into
+// small digits, so the digits of the product are the coefficients of the product of two polynomials:
+// - the exact one takes 16-bit digits, computes the coefficients modulo two primes and recovers them by
+//   the Chinese remainder theorem, which is enough for operands of up to 2^23 limbs together (about 160 million
+//   decimal digits), while bigger ones are split into halves, whose products are added;
+// - the double one takes 16-bit digits for small products and 8-bit ones for big products, so the rounding
+//   errors stay small, and checks that every coefficient is close to an integer, computing the product exactly otherwise
+std::vector<uint64_t> multiplyNtt(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+std::vector<uint64_t> multiplyFft(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+
+
+#endif // FAST_FOURIER_TRANSFORM_H
\ No newline at end of file
@@ -0,0 +1,398 @@
+// Title:   Source file for Fast Fourier Transform
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "FastFourierTransform.h"
+#include <algorithm>
+#include <cmath>
+
+
+// -----------
+// Butterflies
+// -----------
+
+// Arithmetic modulo a prime below 2^30 on values in Montgomery form (x * 2^32 modulo p), where the product
+// of two values is reduced by adding a multiple of p, which makes the lower 32 bits zero, and dropping them
+struct ModularArithmetic {
+	uint32_t modulus;
+	uint32_t negativeInverse;
+
+	uint32_t add(uint32_t a, uint32_t b) const {
+		uint32_t sum = a + b;
+		return sum >= modulus ? sum - modulus : sum;
+	}
+	uint32_t subtract(uint32_t a, uint32_t b) const { return a >= b ? a - b : a + modulus - b; }
+	uint32_t reduce(uint64_t value) const {
+		uint32_t factor = static_cast<uint32_t>(value) * negativeInverse;
+		uint32_t result = static_cast<uint32_t>((value + static_cast<uint64_t>(factor) * modulus) >> 32);
+		return result >= modulus ? result - modulus : result;
+	}
+	uint32_t multiply(uint32_t a, uint32_t b) const { return reduce(static_cast<uint64_t>(a) * b); }
+};
+
+// Arithmetic of complex numbers, whose product is written out, since std::complex checks for infinities
+struct ComplexArithmetic {
+	using Complex = std::complex<double>;
+
+	Complex add(Complex a, Complex b) const { return a + b; }
+	Complex subtract(Complex a, Complex b) const { return a - b; }
+	Complex multiply(Complex a, Complex b) const {
+		return { a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real() };
+	}
+};
+
+// Each level replaces pairs (u, v) of elements at the distance of half a block by (u + v, (u - v) * w^j);
+// two levels at once take four elements at the distance of a quarter of the block, where the second level's
+// roots are squares of the first one's, and w^(size / 4) = i, so the four results need three multiplications
+template <typename Element, typename Arithmetic>
+static void decimateInFrequency(Element* values, int logSize, const Element* roots, const Arithmetic& arithmetic) {
+	size_t size = static_cast<size_t>(1) << logSize;
+	size_t length = size;
+	if (logSize % 2 == 1) {
+		size_t half = size / 2;
+		for (size_t j = 0; j < half; j++) {
+			Element u = values[j];
+			Element v = values[j + half];
+			values[j] = arithmetic.add(u, v);
+			values[j + half] = arithmetic.multiply(arithmetic.subtract(u, v), roots[size + j]);
+		}
+		length = half;
+	}
+	for (; length >= 4; length /= 4) {
+		size_t quarter = length / 4;
+		const Element* w = roots + length;
+		Element imaginary = w[quarter];
+		for (size_t start = 0; start < size; start += length) {
+			Element* x = values + start;
+			for (size_t j = 0; j < quarter; j++) {
+				Element a0 = x[j], a1 = x[j + quarter], a2 = x[j + 2 * quarter], a3 = x[j + 3 * quarter];
+				Element t0 = arithmetic.add(a0, a2);
+				Element t1 = arithmetic.subtract(a0, a2);
+				Element t2 = arithmetic.add(a1, a3);
+				Element t3 = arithmetic.multiply(arithmetic.subtract(a1, a3), imaginary);
+				x[j] = arithmetic.add(t0, t2);
+				x[j + quarter] = arithmetic.multiply(arithmetic.subtract(t0, t2), w[2 * j]);
+				x[j + 2 * quarter] = arithmetic.multiply(arithmetic.add(t1, t3), w[j]);
+				x[j + 3 * quarter] = arithmetic.multiply(arithmetic.subtract(t1, t3), w[3 * j]);
+			}
+		}
+	}
+}
+
+// Undoes the levels above in the reverse order with the inverse roots, each one multiplying the values by 2
+template <typename Element, typename Arithmetic>
+static void decimateInTime(Element* values, int logSize, const Element* inverseRoots, const Arithmetic& arithmetic) {
+	size_t size = static_cast<size_t>(1) << logSize;
+	size_t last = logSize % 2 == 1 ? size / 2 : size;
+	for (size_t length = 4; length <= last; length *= 4) {
+		size_t quarter = length / 4;
+		const Element* w = inverseRoots + length;
+		Element imaginary = w[quarter];
+		for (size_t start = 0; start < size; start += length) {
+			Element* x = values + start;
+			for (size_t j = 0; j < quarter; j++) {
+				Element u1 = arithmetic.multiply(x[j + quarter], w[2 * j]);
+				Element u2 = arithmetic.multiply(x[j + 2 * quarter], w[j]);
+				Element u3 = arithmetic.multiply(x[j + 3 * quarter], w[3 * j]);
+				Element t0 = arithmetic.add(x[j], u1);
+				Element t2 = arithmetic.subtract(x[j], u1);
+				Element t1 = arithmetic.add(u2, u3);
+				Element t3 = arithmetic.multiply(arithmetic.subtract(u2, u3), imaginary);
+				x[j] = arithmetic.add(t0, t1);
+				x[j + quarter] = arithmetic.add(t2, t3);
+				x[j + 2 * quarter] = arithmetic.subtract(t0, t1);
+				x[j + 3 * quarter] = arithmetic.subtract(t2, t3);
+			}
+		}
+	}
+	if (logSize % 2 == 1) {
+		size_t half = size / 2;
+		for (size_t j = 0; j < half; j++) {
+			Element u = values[j];
+			Element v = arithmetic.multiply(values[j + half], inverseRoots[size + j]);
+			values[j] = arithmetic.add(u, v);
+			values[j + half] = arithmetic.subtract(u, v);
+		}
+	}
+}
+
+static int logOfSize(size_t size) {
+	int logSize = 0;
+	while ((static_cast<size_t>(1) << logSize) < size) { logSize++; }
+	return logSize;
+}
+
+// Transforms in place need a power of two, for which the roots were computed
+static bool isSupported(size_t size, int largestLogSize) {
+	return size > 0 && (size & (size - 1)) == 0 && logOfSize(size) <= largestLogSize;
+}
+
+
+// --------------------------
+// Number-Theoretic Transform
+// --------------------------
+
+static uint64_t powerModulo(uint64_t base, uint64_t exponent, uint64_t modulus) {
+	uint64_t result = 1;
+	base %= modulus;
+	for (; exponent > 0; exponent >>= 1) {
+		if (exponent & 1) { result = result * base % modulus; }
+		base = base * base % modulus;
+	}
+	return result;
+}
+
+NumberTheoreticTransform::NumberTheoreticTransform(int maxLogSize, uint32_t primeModulus, uint32_t primitiveRoot)
+	: modulus(primeModulus) {
+	// Newton's iteration doubles the number of correct lower bits of 1/p each time: 1 -> 2 -> ... -> 32
+	uint32_t inverse = modulus;
+	for (int i = 0; i < 5; i++) { inverse *= 2 - modulus * inverse; }
+	negativeInverse = 0 - inverse;
+	uint64_t r = (static_cast<uint64_t>(1) << 32) % modulus;
+	rSquared = static_cast<uint32_t>(r * r % modulus);
+
+	// Roots of order 2^k exist only if 2^k divides p - 1
+	int twos = 0;
+	while ((((modulus - 1) >> twos) & 1) == 0) { twos++; }
+	largestLogSize = std::max(0, std::min(maxLogSize, twos));
+
+	ModularArithmetic arithmetic = { modulus, negativeInverse };
+	size_t maxSize = static_cast<size_t>(1) << largestLogSize;
+	roots.assign(2 * maxSize, 0);
+	inverseRoots.assign(2 * maxSize, 0);
+	if (maxSize < 2) { return; }
+
+	// Powers of the root of the biggest size are products of w^(j mod 64) and w^(64 * (j / 64)), which
+	// don't depend on each other (unlike multiplying by w again and again); roots of smaller sizes are
+	// every second, fourth and so on of them
+	uint64_t root = powerModulo(primitiveRoot, (modulus - 1) / maxSize, modulus);
+	uint64_t inverseRoot = powerModulo(root, modulus - 2, modulus);
+	for (int direction = 0; direction < 2; direction++) {
+		std::vector<uint32_t>& table = direction == 0 ? roots : inverseRoots;
+		uint32_t w = toMontgomery(static_cast<uint32_t>(direction == 0 ? root : inverseRoot));
+		uint32_t small[64];
+		small[0] = toMontgomery(1);
+		for (int j = 1; j < 64; j++) { small[j] = arithmetic.multiply(small[j - 1], w); }
+		uint32_t step = arithmetic.multiply(small[63], w);
+		uint32_t big = small[0];
+		size_t count = std::max<size_t>(1, 3 * maxSize / 4);
+		for (size_t j = 0; j < count; j += 64) {
+			for (size_t k = 0; k < 64 && j + k < count; k++) { table[maxSize + j + k] = arithmetic.multiply(big, small[k]); }
+			big = arithmetic.multiply(big, step);
+		}
+		for (size_t length = maxSize / 2; length >= 2; length /= 2) {
+			size_t stride = maxSize / length;
+			for (size_t j = 0; j < std::max<size_t>(1, 3 * length / 4); j++) { table[length + j] = table[maxSize + j * stride]; }
+		}
+	}
+}
+
+uint32_t NumberTheoreticTransform::toMontgomery(uint32_t value) const {
+	return ModularArithmetic{ modulus, negativeInverse }.multiply(value, rSquared);
+}
+
+uint32_t NumberTheoreticTransform::fromMontgomery(uint32_t value) const {
+	return ModularArithmetic{ modulus, negativeInverse }.reduce(value);
+}
+
+void NumberTheoreticTransform::forwardMontgomery(uint32_t* values, int logSize) const {
+	decimateInFrequency(values, logSize, roots.data(), ModularArithmetic{ modulus, negativeInverse });
+}
+
+void NumberTheoreticTransform::inverseMontgomery(uint32_t* values, int logSize) const {
+	decimateInTime(values, logSize, inverseRoots.data(), ModularArithmetic{ modulus, negativeInverse });
+}
+
+bool NumberTheoreticTransform::forward(std::vector<uint32_t>& values) const {
+	if (!isSupported(values.size(), largestLogSize)) { return false; }
+	for (uint32_t& value : values) { value = toMontgomery(value); }
+	forwardMontgomery(values.data(), logOfSize(values.size()));
+	for (uint32_t& value : values) { value = fromMontgomery(value); }
+	return true;
+}
+
+// Multiplying a value in Montgomery form by an ordinary 1/size gives the ordinary result at once
+bool NumberTheoreticTransform::inverse(std::vector<uint32_t>& values) const {
+	if (!isSupported(values.size(), largestLogSize)) { return false; }
+	ModularArithmetic arithmetic = { modulus, negativeInverse };
+	uint32_t sizeInverse = static_cast<uint32_t>(powerModulo(values.size(), modulus - 2, modulus));
+	for (uint32_t& value : values) { value = toMontgomery(value); }
+	inverseMontgomery(values.data(), logOfSize(values.size()));
+	for (uint32_t& value : values) { value = arithmetic.multiply(value, sizeInverse); }
+	return true;
+}
+
+// Transforms of both polynomials are multiplied pointwise, which is the transform of their product,
+// as long as the size is enough for all of its coefficients (otherwise they would wrap around)
+std::vector<uint32_t> NumberTheoreticTransform::multiply(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b) const {
+	if (a.empty() || b.empty()) { return {}; }
+	size_t resultSize = a.size() + b.size() - 1;
+	int logSize = logOfSize(resultSize);
+	if (logSize > largestLogSize) { return {}; }
+	size_t size = static_cast<size_t>(1) << logSize;
+	ModularArithmetic arithmetic = { modulus, negativeInverse };
+
+	std::vector<uint32_t> first(size, 0), second(size, 0);
+	for (size_t i = 0; i < a.size(); i++) { first[i] = toMontgomery(a[i]); }
+	for (size_t i = 0; i < b.size(); i++) { second[i] = toMontgomery(b[i]); }
+	forwardMontgomery(first.data(), logSize);
+	forwardMontgomery(second.data(), logSize);
+	for (size_t i = 0; i < size; i++) { first[i] = arithmetic.multiply(first[i], second[i]); }
+	inverseMontgomery(first.data(), logSize);
+
+	uint32_t sizeInverse = static_cast<uint32_t>(powerModulo(size, modulus - 2, modulus));
+	std::vector<uint32_t> result(resultSize);
+	for (size_t i = 0; i < resultSize; i++) { result[i] = arithmetic.multiply(first[i], sizeInverse); }
+	return result;
+}
+
+
+// ----------------------
+// Fast Fourier Transform
+// ----------------------
+
+FastFourierTransform::FastFourierTransform(int maxLogSize) : largestLogSize(std::max(0, maxLogSize)) {
+	const double pi = std::acos(-1.0);
+	size_t maxSize = static_cast<size_t>(1) << largestLogSize;
+	roots.assign(2 * maxSize, 0);
+	inverseRoots.assign(2 * maxSize, 0);
+	for (size_t length = 2; length <= maxSize; length *= 2) {
+		for (size_t j = 0; j < std::max<size_t>(1, 3 * length / 4); j++) {
+			double angle = 2 * pi * static_cast<double>(j) / static_cast<double>(length);
+			roots[length + j] = { std::cos(angle), -std::sin(angle) };
+			inverseRoots[length + j] = { std::cos(angle), std::sin(angle) };
+		}
+	}
+}
+
+bool FastFourierTransform::forward(std::vector<std::complex<double>>& values) const {
+	if (!isSupported(values.size(), largestLogSize)) { return false; }
+	decimateInFrequency(values.data(), logOfSize(values.size()), roots.data(), ComplexArithmetic());
+	return true;
+}
+
+bool FastFourierTransform::inverse(std::vector<std::complex<double>>& values) const {
+	if (!isSupported(values.size(), largestLogSize)) { return false; }
+	decimateInTime(values.data(), logOfSize(values.size()), inverseRoots.data(), ComplexArithmetic());
+	double scale = 1.0 / static_cast<double>(values.size());
+	for (std::complex<double>& value : values) { value *= scale; }
+	return true;
+}
+
+// Both polynomials go into one complex sequence z = a + ib, since the square of its transform is the transform
+// of z * z = a * a - b * b + 2i (a * b), so a single forward transform is enough and the product is half of
+// the imaginary part
+std::vector<double> FastFourierTransform::multiply(const std::vector<double>& a, const std::vector<double>& b) const {
+	if (a.empty() || b.empty()) { return {}; }
+	size_t resultSize = a.size() + b.size() - 1;
+	if (logOfSize(resultSize) > largestLogSize) { return {}; }
+	size_t size = static_cast<size_t>(1) << logOfSize(resultSize);
+	std::vector<std::complex<double>> values(size, 0);
+	for (size_t i = 0; i < a.size(); i++) { values[i].real(a[i]); }
+	for (size_t i = 0; i < b.size(); i++) { values[i].imag(b[i]); }
+	forward(values);
+	ComplexArithmetic arithmetic;
+	for (std::complex<double>& value : values) { value = arithmetic.multiply(value, value); }
+	inverse(values);
+
+	std::vector<double> result(resultSize);
+	for (size_t i = 0; i < resultSize; i++) { result[i] = values[i].imag() / 2; }
+	return result;
+}
+
+
+// ------------
+// Big Integers
+// ------------
+
+// Limbs are split into digits of 'bits' bits (a divisor of 64) from the lowest one
+static std::vector<uint32_t> toDigits(const std::vector<uint64_t>& limbs, int bits) {
+	size_t perLimb = 64 / bits;
+	uint64_t mask = (static_cast<uint64_t>(1) << bits) - 1;
+	std::vector<uint32_t> digits(perLimb * limbs.size());
+	for (size_t i = 0; i < digits.size(); i++) { digits[i] = static_cast<uint32_t>((limbs[i / perLimb] >> (bits * (i % perLimb))) & mask); }
+	return digits;
+}
+
+// Moves the carries of the coefficients (each one below 2^57) on and packs the digits back into limbs
+static std::vector<uint64_t> fromCoefficients(const std::vector<uint64_t>& coefficients, size_t limbCount, int bits) {
+	size_t perLimb = 64 / bits;
+	uint64_t mask = (static_cast<uint64_t>(1) << bits) - 1;
+	std::vector<uint64_t> limbs(limbCount, 0);
+	uint64_t carry = 0;
+	for (size_t i = 0; i < perLimb * limbCount; i++) {
+		uint64_t total = carry + (i < coefficients.size() ? coefficients[i] : 0);
+		limbs[i / perLimb] |= (total & mask) << (bits * (i % perLimb));
+		carry = total >> bits;
+	}
+	return limbs;
+}
+
+// The first prime has roots of unity of orders up to 2^25, which limits the transform to 2^25 digits,
+// so both operands together can have at most 2^23 limbs
+static const size_t maxNttLimbs = static_cast<size_t>(1) << 23;
+
+// Products beyond the limit are split by halves of the longer operand: a * b = a0 * b + (a1 * b) << half,
+// which fits into the limbs of the whole product, so no carry goes past its end
+static std::vector<uint64_t> multiplyByHalves(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b) {
+	if (a.size() < b.size()) { return multiplyByHalves(b, a); }
+	size_t half = a.size() / 2;
+	std::vector<uint64_t> result = multiplyNtt(std::vector<uint64_t>(a.begin(), a.begin() + half), b);
+	std::vector<uint64_t> upper = multiplyNtt(std::vector<uint64_t>(a.begin() + half, a.end()), b);
+	result.resize(a.size() + b.size(), 0);
+	uint64_t carry = 0;
+	for (size_t i = 0; i < upper.size(); i++) {
+		uint64_t sum = result[half + i] + carry;
+		carry = sum < carry;
+		result[half + i] = sum + upper[i];
+		carry += result[half + i] < sum;
+	}
+	return result;
+}
+
+// Within the limit the shorter operand has at most 2^24 digits, so coefficients are below
+// 2^24 * (2^16 - 1)^2 < 2^56 < p1 * p2 (about 2^56.13), a thin margin, but enough to know them exactly
+// from their residues modulo both primes: x = r1 + p1 * ((r2 - r1) / p1 modulo p2)
+std::vector<uint64_t> multiplyNtt(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b) {
+	const uint32_t firstPrime = 167772161;    // 5 * 2^25 + 1
+	const uint32_t secondPrime = 469762049;   // 7 * 2^26 + 1
+	size_t limbCount = a.size() + b.size();
+	if (a.empty() || b.empty()) { return std::vector<uint64_t>(limbCount, 0); }
+	if (limbCount > maxNttLimbs) { return multiplyByHalves(a, b); }
+
+	std::vector<uint32_t> first = toDigits(a, 16), second = toDigits(b, 16);
+	int logSize = logOfSize(first.size() + second.size() - 1);
+	std::vector<uint32_t> residues = NumberTheoreticTransform(logSize, firstPrime, 3).multiply(first, second);
+	std::vector<uint32_t> otherResidues = NumberTheoreticTransform(logSize, secondPrime, 3).multiply(first, second);
+
+	uint64_t firstInverse = powerModulo(firstPrime, secondPrime - 2, secondPrime);
+	std::vector<uint64_t> coefficients(residues.size());
+	for (size_t i = 0; i < residues.size(); i++) {
+		uint64_t difference = (otherResidues[i] + secondPrime - residues[i] % secondPrime) % secondPrime;
+		coefficients[i] = residues[i] + static_cast<uint64_t>(firstPrime) * (difference * firstInverse % secondPrime);
+	}
+	return fromCoefficients(coefficients, limbCount, 16);
+}
+
+// Rounding errors grow with the size and the digits: coefficients of up to about 2^46 are safe, so 16-bit
+// digits are used for products up to 8192 limbs and 8-bit ones beyond that; still, a coefficient further
+// than 1/4 from an integer means that some of them might be rounded to a wrong one
+std::vector<uint64_t> multiplyFft(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b) {
+	size_t limbCount = a.size() + b.size();
+	if (a.empty() || b.empty()) { return std::vector<uint64_t>(limbCount, 0); }
+
+	int bits = limbCount <= 8192 ? 16 : 8;
+	std::vector<uint32_t> first = toDigits(a, bits), second = toDigits(b, bits);
+	std::vector<double> firstDigits(first.begin(), first.end()), secondDigits(second.begin(), second.end());
+	std::vector<double> product = FastFourierTransform(logOfSize(first.size() + second.size() - 1)).multiply(firstDigits, secondDigits);
+
+	std::vector<uint64_t> coefficients(product.size());
+	for (size_t i = 0; i < product.size(); i++) {
+		double rounded = std::round(product[i]);
+		if (std::fabs(product[i] - rounded) > 0.25) { return multiplyNtt(a, b); }
+		coefficients[i] = rounded < 0 ? 0 : static_cast<uint64_t>(rounded);
+	}
+	return fromCoefficients(coefficients, limbCount, bits);
+}
\ No newline at end of file
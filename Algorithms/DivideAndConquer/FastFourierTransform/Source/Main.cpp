@@ -0,0 +1,110 @@
+// Title:   Fast Fourier Transform Algorithm
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "FastFourierTransform.h"
+#include "BigInteger.h"   // From the Karatsuba Algorithm folder
+
+
+// Runs 'compute' and returns the elapsed milliseconds
+template <typename Compute>
+double milliseconds(Compute compute) {
+	auto start = std::chrono::steady_clock::now();
+	compute();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+std::vector<uint64_t> randomLimbs(size_t count, std::mt19937_64& engine) {
+	std::vector<uint64_t> limbs(count);
+	for (uint64_t& limb : limbs) { limb = engine(); }
+	return limbs;
+}
+
+// Multiplies random numbers of the given sizes by both transforms and by BigInteger, which uses Karatsuba
+// and Toom-3 for such sizes, and displays the times in one row
+void compare(size_t limbs, std::mt19937_64& engine) {
+	std::vector<uint64_t> a = randomLimbs(limbs, engine), b = randomLimbs(limbs, engine);
+	BigInteger first = BigInteger::fromLimbs(a), second = BigInteger::fromLimbs(b), product;
+	std::vector<uint64_t> ntt, fft;
+	std::cout << std::setw(8) << limbs << std::setw(12) << static_cast<size_t>(limbs * 19.27) << std::fixed << std::setprecision(2);
+	std::cout << std::setw(18) << milliseconds([&]() { product = first * second; });
+	std::cout << std::setw(10) << milliseconds([&]() { ntt = multiplyNtt(a, b); });
+	std::cout << std::setw(10) << milliseconds([&]() { fft = multiplyFft(a, b); });
+	bool same = BigInteger::fromLimbs(ntt) == product && BigInteger::fromLimbs(fft) == product;
+	std::cout << (same ? "   (same)" : "   (different!)") << std::endl;
+}
+
+void printHeader() {
+	std::cout << std::setw(8) << "Limbs" << std::setw(12) << "Digits" << std::setw(18) << "Karatsuba/Toom-3"
+		<< std::setw(10) << "NTT" << std::setw(10) << "FFT" << "   (ms)" << std::endl;
+}
+
+// Finds the crossover of the transforms against Karatsuba and Toom-3 on numbers of growing sizes
+void benchmark() {
+	std::mt19937_64 engine(2024);
+	printHeader();
+	for (size_t limbs = 64; limbs <= 262144; limbs *= 2) { compare(limbs, engine); }
+}
+
+int main() {
+	// Greet
+	std::cout << "\tWelcome to the 'Fast Fourier Transform' console application!\n\n";
+
+	// Prompt the user for polynomials
+	std::vector<std::vector<uint32_t>> polynomials(2);
+	for (int p = 0; p < 2; p++) {
+		std::cout << "Enter the number of coefficients of polynomial #" << p + 1 << ": ";
+		int count = 0;
+		std::cin >> count;
+		std::cout << "Enter its coefficients from the lowest power (non-negative integers): ";
+		polynomials[p].resize(count);
+		for (uint32_t& coefficient : polynomials[p]) { std::cin >> coefficient; }
+	}
+
+	// Multiply them by both transforms
+	NumberTheoreticTransform ntt(20);
+	FastFourierTransform fft(20);
+	std::vector<uint32_t> exact = ntt.multiply(polynomials[0], polynomials[1]);
+	std::vector<double> approximate = fft.multiply(std::vector<double>(polynomials[0].begin(), polynomials[0].end()),
+		std::vector<double>(polynomials[1].begin(), polynomials[1].end()));
+	if (exact.empty() && !polynomials[0].empty() && !polynomials[1].empty()) {
+		std::cout << "The product has more than 2^" << ntt.maxLogSize() << " coefficients, which the transforms don't support.\n\n";
+	}
+	else {
+		std::cout << "Product by NTT (modulo " << ntt.prime() << "):\n ";
+		for (uint32_t coefficient : exact) { std::cout << coefficient << " "; }
+		std::cout << "\nProduct by FFT:\n " << std::fixed << std::setprecision(3);
+		for (double coefficient : approximate) { std::cout << coefficient << " "; }
+		std::cout << "\n\n";
+	}
+
+	// Multiply big numbers
+	std::cout << "Enter the number of limbs of two random numbers to multiply (e.g. 50000, each one is 19.27 digits): ";
+	size_t limbs = 0;
+	std::cin >> limbs;
+	std::mt19937_64 engine(2026);
+	printHeader();
+	compare(limbs, engine);
+	std::cout << std::endl;
+
+	// Compare the methods
+	std::cout << "Run the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) { benchmark(); }
+
+	// Exit
+	std::cout << "\nThanks for using this program! Have a great day!\n";
+	std::cout << "Press <Enter> to exit...";
+	std::cin.ignore();
+	std::cin.get();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+// Title:   Header file for Big Integer
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef BIG_INTEGER_H
+#define BIG_INTEGER_H
+
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+// Signed integer of any size, stored as a sign and a magnitude of 64-bit limbs starting from the lowest one;
+// products are computed by the schoolbook method for small sizes, by Karatsuba's algorithm for medium ones
+// and by Toom-Cook (Toom-3) for large ones, with thresholds taken from the benchmark in Main.cpp
+class BigInteger {
+public:
+	enum class Multiplication { Automatic, Schoolbook, Karatsuba, ToomCook3 };
+
+	static constexpr size_t karatsubaThreshold = 24;   // Limbs of the shorter operand, from which Karatsuba is used
+	static constexpr size_t toomCook3Threshold = 320;  // ... and from which Toom-3 is used
+
+private:
+	std::vector<uint64_t> limbs;   // No leading zero limbs, empty for zero
+	bool negative = false;         // Never set for zero
+
+	void trim();
+	static int compareMagnitudes(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+	static void addAt(std::vector<uint64_t>& target, const uint64_t* value, size_t size, size_t shift);
+	static void subtractAt(std::vector<uint64_t>& target, const uint64_t* value, size_t size, size_t shift);
+	static std::vector<uint64_t> schoolbook(const uint64_t* a, size_t sizeA, const uint64_t* b, size_t sizeB);
+	static std::vector<uint64_t> karatsuba(const uint64_t* a, size_t sizeA, const uint64_t* b, size_t sizeB);
+	static std::vector<uint64_t> toomCook3(const uint64_t* a, size_t sizeA, const uint64_t* b, size_t sizeB);
+	static std::vector<uint64_t> multiplyMagnitudes(const uint64_t* a, size_t sizeA, const uint64_t* b, size_t sizeB,
+		Multiplication method);
+	uint64_t divideMagnitude(uint64_t divisor);   // Returns the remainder
+	void multiplyAdd(uint64_t factor, uint64_t addend);
+	void halveExactly();                          // Divisions, which are known to leave no remainder
+	void divideExactly(uint64_t divisor);
+
+public:
+	BigInteger(int64_t value = 0);
+	explicit BigInteger(const std::string& decimal);   // Optional '-' followed by digits
+	static BigInteger fromLimbs(std::vector<uint64_t> magnitude, bool isNegative = false);
+
+	size_t size() const { return limbs.size(); }
+	bool isNegative() const { return negative; }
+
+	BigInteger operator-() const;
+	BigInteger& operator+=(const BigInteger& rhs);
+	BigInteger& operator-=(const BigInteger& rhs);
+	BigInteger& operator*=(const BigInteger& rhs);
+	friend BigInteger operator+(BigInteger lhs, const BigInteger& rhs) { return lhs += rhs; }
+	friend BigInteger operator-(BigInteger lhs, const BigInteger& rhs) { return lhs -= rhs; }
+	friend BigInteger operator*(const BigInteger& lhs, const BigInteger& rhs) { return multiply(lhs, rhs); }
+
+	// Product by the given method at the top level, while smaller products choose their own
+	static BigInteger multiply(const BigInteger& lhs, const BigInteger& rhs, Multiplication method = Multiplication::Automatic);
+
+	friend bool operator==(const BigInteger& lhs, const BigInteger& rhs);
+	friend bool operator<(const BigInteger& lhs, const BigInteger& rhs);
+	friend bool operator!=(const BigInteger& lhs, const BigInteger& rhs) { return !(lhs == rhs); }
+	friend bool operator>(const BigInteger& lhs, const BigInteger& rhs) { return rhs < lhs; }
+	friend bool operator<=(const BigInteger& lhs, const BigInteger& rhs) { return !(rhs < lhs); }
+	friend bool operator>=(const BigInteger& lhs, const BigInteger& rhs) { return !(lhs < rhs); }
+
+	std::string toString() const;
+};
+
+
+#endif // BIG_INTEGER_H
\ No newline at end of file
@@ -8,8 +8,15 @@
 #define KARATSUBA_H
 
 
+#include "BigInteger.h"
+
+
 int countDigits(unsigned long long num);
-unsigned long long karatsuba(unsigned long long a, unsigned long long b);
+unsigned long long powerOfTen(int exponent);
+unsigned long long karatsuba(unsigned long long a, unsigned long long b);   // Note: the product must fit into 64 bits
+
+// Same algorithm for integers of any size, splitting 64-bit limbs instead of decimal digits
+BigInteger karatsuba(const BigInteger& a, const BigInteger& b);
 
 
 #endif // KARATSUBA_H
@@ -0,0 +1,342 @@
+// Title:   Source file for Big Integer
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "BigInteger.h"
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+static uint64_t multiplyWide(uint64_t a, uint64_t b, uint64_t& high) { return _umul128(a, b, &high); }
+static uint64_t divideWide(uint64_t high, uint64_t low, uint64_t divisor, uint64_t& remainder) {
+	return _udiv128(high, low, divisor, &remainder);
+}
+#else
+static uint64_t multiplyWide(uint64_t a, uint64_t b, uint64_t& high) {
+	unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+	high = static_cast<uint64_t>(product >> 64);
+	return static_cast<uint64_t>(product);
+}
+static uint64_t divideWide(uint64_t high, uint64_t low, uint64_t divisor, uint64_t& remainder) {
+	unsigned __int128 dividend = (static_cast<unsigned __int128>(high) << 64) | low;
+	remainder = static_cast<uint64_t>(dividend % divisor);
+	return static_cast<uint64_t>(dividend / divisor);
+}
+#endif
+
+
+BigInteger::BigInteger(int64_t value) : negative(value < 0) {
+	// Magnitude of the smallest value doesn't fit into int64_t, so it's taken as unsigned
+	uint64_t magnitude = negative ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+	if (magnitude != 0) { limbs.push_back(magnitude); }
+}
+
+BigInteger::BigInteger(const std::string& decimal) {
+	// Digits are taken by 19, the most that fit into a limb, the first group being shorter if needed
+	size_t start = !decimal.empty() && decimal[0] == '-' ? 1 : 0;
+	size_t group = (decimal.size() - start) % 19;
+	for (size_t i = start; i < decimal.size(); i += group, group = 19) {
+		uint64_t value = 0;
+		uint64_t scale = 1;
+		for (size_t j = i; j < i + group; j++) {
+			value = value * 10 + static_cast<uint64_t>(decimal[j] - '0');
+			scale *= 10;
+		}
+		multiplyAdd(scale, value);
+	}
+	negative = start == 1 && !limbs.empty();
+}
+
+BigInteger BigInteger::fromLimbs(std::vector<uint64_t> magnitude, bool isNegative) {
+	BigInteger number;
+	number.limbs = std::move(magnitude);
+	number.trim();
+	number.negative = isNegative && !number.limbs.empty();
+	return number;
+}
+
+void BigInteger::trim() {
+	while (!limbs.empty() && limbs.back() == 0) { limbs.pop_back(); }
+	if (limbs.empty()) { negative = false; }
+}
+
+int BigInteger::compareMagnitudes(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b) {
+	if (a.size() != b.size()) { return a.size() < b.size() ? -1 : 1; }
+	for (size_t i = a.size(); i-- > 0;) {
+		if (a[i] != b[i]) { return a[i] < b[i] ? -1 : 1; }
+	}
+	return 0;
+}
+
+// target += value * 2^(64 * shift)
+void BigInteger::addAt(std::vector<uint64_t>& target, const uint64_t* value, size_t size, size_t shift) {
+	if (target.size() < shift + size) { target.resize(shift + size, 0); }
+	uint64_t carry = 0;
+	size_t i = 0;
+	for (; i < size; i++) {
+		uint64_t sum = target[shift + i] + value[i];
+		uint64_t overflow = sum < value[i];
+		sum += carry;
+		carry = overflow | (sum < carry);
+		target[shift + i] = sum;
+	}
+	for (; carry; i++) {
+		if (shift + i == target.size()) { target.push_back(0); }
+		carry = ++target[shift + i] == 0;
+	}
+}
+
+// target -= value * 2^(64 * shift), where target is not less than it
+void BigInteger::subtractAt(std::vector<uint64_t>& target, const uint64_t* value, size_t size, size_t shift) {
+	uint64_t borrow = 0;
+	size_t i = 0;
+	for (; i < size; i++) {
+		uint64_t minuend = target[shift + i];
+		uint64_t subtrahend = value[i] + borrow;
+		uint64_t overflow = subtrahend < borrow;
+		target[shift + i] = minuend - subtrahend;
+		borrow = overflow | (minuend < subtrahend);
+	}
+	for (; borrow; i++) { borrow = target[shift + i]-- == 0; }
+}
+
+uint64_t BigInteger::divideMagnitude(uint64_t divisor) {
+	uint64_t remainder = 0;
+	for (size_t i = limbs.size(); i-- > 0;) { limbs[i] = divideWide(remainder, limbs[i], divisor, remainder); }
+	trim();
+	return remainder;
+}
+
+void BigInteger::multiplyAdd(uint64_t factor, uint64_t addend) {
+	uint64_t carry = addend;
+	for (uint64_t& limb : limbs) {
+		uint64_t high = 0;
+		uint64_t low = multiplyWide(limb, factor, high);
+		limb = low + carry;
+		carry = high + (limb < low);
+	}
+	if (carry != 0) { limbs.push_back(carry); }
+}
+
+void BigInteger::halveExactly() {
+	for (size_t i = 0; i < limbs.size(); i++) {
+		limbs[i] = (limbs[i] >> 1) | (i + 1 < limbs.size() ? limbs[i + 1] << 63 : 0);
+	}
+	trim();
+}
+
+void BigInteger::divideExactly(uint64_t divisor) {
+	bool sign = negative;
+	divideMagnitude(divisor);
+	negative = sign && !limbs.empty();
+}
+
+
+// --------------
+// Multiplication
+// --------------
+
+// Every limb of b multiplies the whole a, and the row is added to the result with the carries: O(n * m)
+std::vector<uint64_t> BigInteger::schoolbook(const uint64_t* a, size_t sizeA, const uint64_t* b, size_t sizeB) {
+	std::vector<uint64_t> result(sizeA + sizeB, 0);
+	for (size_t i = 0; i < sizeB; i++) {
+		uint64_t carry = 0;
+		uint64_t* row = result.data() + i;
+		for (size_t j = 0; j < sizeA; j++) {
+			uint64_t high = 0;
+			uint64_t low = multiplyWide(a[j], b[i], high);
+			low += carry;
+			high += low < carry;
+			low += row[j];
+			high += low < row[j];
+			row[j] = low;
+			carry = high;
+		}
+		row[sizeA] = carry;
+	}
+	return result;
+}
+
+// With a = a1 * X + a0 and b = b1 * X + b0 the product needs only three smaller ones,
+// a0 * b0, a1 * b1 and (a0 + a1) * (b0 + b1), as the middle part is the last one minus the others: O(n^1.585)
+std::vector<uint64_t> BigInteger::karatsuba(const uint64_t* a, size_t sizeA, const uint64_t* b, size_t sizeB) {
+	size_t half = (sizeA + 1) / 2;
+	std::vector<uint64_t> low = multiplyMagnitudes(a, half, b, half, Multiplication::Automatic);
+	std::vector<uint64_t> high = multiplyMagnitudes(a + half, sizeA - half, b + half, sizeB - half, Multiplication::Automatic);
+	std::vector<uint64_t> sumA(a, a + half);
+	std::vector<uint64_t> sumB(b, b + half);
+	addAt(sumA, a + half, sizeA - half, 0);
+	addAt(sumB, b + half, sizeB - half, 0);
+	std::vector<uint64_t> middle = multiplyMagnitudes(sumA.data(), sumA.size(), sumB.data(), sumB.size(), Multiplication::Automatic);
+	subtractAt(middle, low.data(), low.size(), 0);
+	subtractAt(middle, high.data(), high.size(), 0);
+
+	std::vector<uint64_t> result(sizeA + sizeB, 0);
+	addAt(result, low.data(), low.size(), 0);
+	addAt(result, middle.data(), middle.size(), half);
+	addAt(result, high.data(), high.size(), 2 * half);
+	result.resize(sizeA + sizeB);
+	return result;
+}
+
+// Splits both numbers into three parts, a = a2 * X^2 + a1 * X + a0, evaluates both polynomials at 0, 1, -1, -2
+// and infinity, multiplies the five values and interpolates the product's five coefficients back (Bodrato's
+// sequence, which needs only exact divisions by 2 and 3): five products of a third of the size, O(n^1.465)
+std::vector<uint64_t> BigInteger::toomCook3(const uint64_t* a, size_t sizeA, const uint64_t* b, size_t sizeB) {
+	size_t part = (sizeA + 2) / 3;
+	auto piece = [part](const uint64_t* x, size_t size, size_t index) {
+		size_t begin = std::min(size, index * part);
+		size_t end = index == 2 ? size : std::min(size, begin + part);
+		return fromLimbs(std::vector<uint64_t>(x + begin, x + end));
+	};
+	BigInteger a0 = piece(a, sizeA, 0), a1 = piece(a, sizeA, 1), a2 = piece(a, sizeA, 2);
+	BigInteger b0 = piece(b, sizeB, 0), b1 = piece(b, sizeB, 1), b2 = piece(b, sizeB, 2);
+
+	// Evaluation
+	BigInteger evenA = a0 + a2;
+	BigInteger oneA = evenA + a1;
+	BigInteger minusOneA = evenA - a1;
+	BigInteger minusTwoA = minusOneA + a2;
+	minusTwoA += minusTwoA;
+	minusTwoA -= a0;
+	BigInteger evenB = b0 + b2;
+	BigInteger oneB = evenB + b1;
+	BigInteger minusOneB = evenB - b1;
+	BigInteger minusTwoB = minusOneB + b2;
+	minusTwoB += minusTwoB;
+	minusTwoB -= b0;
+
+	// Pointwise products
+	BigInteger r0 = a0 * b0;
+	BigInteger rOne = oneA * oneB;
+	BigInteger rMinusOne = minusOneA * minusOneB;
+	BigInteger rMinusTwo = minusTwoA * minusTwoB;
+	BigInteger rInfinity = a2 * b2;
+
+	// Interpolation
+	BigInteger r3 = rMinusTwo - rOne;
+	r3.divideExactly(3);
+	BigInteger r1 = rOne - rMinusOne;
+	r1.halveExactly();
+	BigInteger r2 = rMinusOne - r0;
+	r3 = r2 - r3;
+	r3.halveExactly();
+	r3 += rInfinity + rInfinity;
+	r2 += r1;
+	r2 -= rInfinity;
+	r1 -= r3;
+
+	// Coefficients of a product of non-negative numbers are non-negative, so only magnitudes are added
+	std::vector<uint64_t> result(sizeA + sizeB, 0);
+	const BigInteger* coefficients[] = { &r0, &r1, &r2, &r3, &rInfinity };
+	for (size_t i = 0; i < 5; i++) { addAt(result, coefficients[i]->limbs.data(), coefficients[i]->limbs.size(), i * part); }
+	result.resize(sizeA + sizeB);
+	return result;
+}
+
+// Chooses the method by the size of the shorter operand; a much longer operand is split into pieces
+// of the shorter one's size, so that Karatsuba and Toom-3 always get operands of similar sizes
+std::vector<uint64_t> BigInteger::multiplyMagnitudes(const uint64_t* a, size_t sizeA, const uint64_t* b, size_t sizeB,
+	Multiplication method) {
+	if (sizeA < sizeB) {
+		std::swap(a, b);
+		std::swap(sizeA, sizeB);
+	}
+	if (method == Multiplication::Automatic) {
+		method = sizeB < karatsubaThreshold ? Multiplication::Schoolbook
+			: sizeB < toomCook3Threshold ? Multiplication::Karatsuba : Multiplication::ToomCook3;
+	}
+	if (method == Multiplication::Schoolbook || sizeB < 3) { return schoolbook(a, sizeA, b, sizeB); }
+
+	if (sizeA >= 2 * sizeB) {
+		std::vector<uint64_t> result(sizeA + sizeB, 0);
+		for (size_t offset = 0; offset < sizeA; offset += sizeB) {
+			std::vector<uint64_t> product = multiplyMagnitudes(a + offset, std::min(sizeB, sizeA - offset), b, sizeB, method);
+			addAt(result, product.data(), product.size(), offset);
+		}
+		result.resize(sizeA + sizeB);
+		return result;
+	}
+	return method == Multiplication::Karatsuba ? karatsuba(a, sizeA, b, sizeB) : toomCook3(a, sizeA, b, sizeB);
+}
+
+BigInteger BigInteger::multiply(const BigInteger& lhs, const BigInteger& rhs, Multiplication method) {
+	BigInteger product;
+	product.limbs = multiplyMagnitudes(lhs.limbs.data(), lhs.limbs.size(), rhs.limbs.data(), rhs.limbs.size(), method);
+	product.negative = lhs.negative != rhs.negative;
+	product.trim();
+	return product;
+}
+
+
+// ---------
+// Operators
+// ---------
+
+BigInteger BigInteger::operator-() const {
+	BigInteger result = *this;
+	result.negative = !negative && !limbs.empty();
+	return result;
+}
+
+// Same signs add the magnitudes, different ones subtract the smaller magnitude from the bigger one
+BigInteger& BigInteger::operator+=(const BigInteger& rhs) {
+	if (negative == rhs.negative) {
+		addAt(limbs, rhs.limbs.data(), rhs.limbs.size(), 0);
+	}
+	else if (compareMagnitudes(limbs, rhs.limbs) >= 0) {
+		subtractAt(limbs, rhs.limbs.data(), rhs.limbs.size(), 0);
+	}
+	else {
+		std::vector<uint64_t> magnitude = rhs.limbs;
+		subtractAt(magnitude, limbs.data(), limbs.size(), 0);
+		limbs = std::move(magnitude);
+		negative = rhs.negative;
+	}
+	trim();
+	return *this;
+}
+
+BigInteger& BigInteger::operator-=(const BigInteger& rhs) {
+	if (this == &rhs) { return *this = BigInteger(); }
+	negative = !negative;
+	*this += rhs;
+	negative = !negative && !limbs.empty();
+	return *this;
+}
+
+BigInteger& BigInteger::operator*=(const BigInteger& rhs) { return *this = multiply(*this, rhs); }
+
+bool operator==(const BigInteger& lhs, const BigInteger& rhs) {
+	return lhs.negative == rhs.negative && lhs.limbs == rhs.limbs;
+}
+
+bool operator<(const BigInteger& lhs, const BigInteger& rhs) {
+	if (lhs.negative != rhs.negative) { return lhs.negative; }
+	int order = BigInteger::compareMagnitudes(lhs.limbs, rhs.limbs);
+	return lhs.negative ? order > 0 : order < 0;
+}
+
+
+// ------
+// Output
+// ------
+
+// Takes 19 decimal digits at a time, the most that fit into a limb
+std::string BigInteger::toString() const {
+	if (limbs.empty()) { return "0"; }
+	const uint64_t chunk = 10000000000000000000ull;
+	BigInteger rest = *this;
+	std::vector<uint64_t> parts;
+	while (!rest.limbs.empty()) { parts.push_back(rest.divideMagnitude(chunk)); }
+	std::string result = negative ? "-" : "";
+	result += std::to_string(parts.back());
+	for (size_t i = parts.size() - 1; i-- > 0;) {
+		std::string digits = std::to_string(parts[i]);
+		result.append(19 - digits.size(), '0');
+		result += digits;
+	}
+	return result;
+}
\ No newline at end of file
@@ -4,7 +4,6 @@
 // ----------------------------------------------------------------------------
 
 
-#include <cmath>
 #include "KaratsubaAlgorithm.h"
 
 
@@ -17,6 +16,12 @@ int countDigits(unsigned long long num) {
 	return digits;
 }
 
+// Exact integer power, since floating-point pow() loses the lowest digits of big powers
+unsigned long long powerOfTen(int exponent) {
+	unsigned long long power = 1;
+	for (int i = 0; i < exponent; i++) { power *= 10; }
+	return power;
+}
 
 unsigned long long karatsuba(unsigned long long a, unsigned long long b) {
 	if (a < 10 || b < 10) { return a * b; }
@@ -24,14 +29,19 @@ unsigned long long karatsuba(unsigned long long a, unsigned long long b) {
 	int digitsInLarger = (countDigits(a) > countDigits(b)) ? countDigits(a) : countDigits(b);
 	int half = digitsInLarger / 2;
 
-	unsigned long long aHighHalf = a / (unsigned long long)pow(10, half); // 123456 / 10^3 = 123
-	unsigned long long aLowHalf = a % (unsigned long long)pow(10, half); // 123456 % 10^3 = 456
-	unsigned long long bHighHalf = b / (unsigned long long)pow(10, half);
-	unsigned long long bLowHalf = b % (unsigned long long)pow(10, half);
+	unsigned long long shift = powerOfTen(half);
+	unsigned long long aHighHalf = a / shift; // 123456 / 10^3 = 123
+	unsigned long long aLowHalf = a % shift; // 123456 % 10^3 = 456
+	unsigned long long bHighHalf = b / shift;
+	unsigned long long bLowHalf = b % shift;
 
 	unsigned long long lowPart = karatsuba(aLowHalf, bLowHalf);
 	unsigned long long crossPart = karatsuba((aLowHalf + aHighHalf), (bLowHalf + bHighHalf));
 	unsigned long long highPart = karatsuba(aHighHalf, bHighHalf);
 
-	return highPart * pow(10, 2 * half) + (crossPart - highPart - lowPart) * pow(10, half) + lowPart;
+	return highPart * shift * shift + (crossPart - highPart - lowPart) * shift + lowPart;
+}
+
+BigInteger karatsuba(const BigInteger& a, const BigInteger& b) {
+	return BigInteger::multiply(a, b, BigInteger::Multiplication::Karatsuba);
 }
\ No newline at end of file
@@ -5,9 +5,53 @@
 
 
 #include <iostream>
+#include <iomanip>
+#include <string>
+#include <random>
+#include <chrono>
 #include "KaratsubaAlgorithm.h"
+#include "BigInteger.h"
 
 
+// Runs 'compute' and returns the elapsed milliseconds
+template <typename Compute>
+double milliseconds(Compute compute) {
+	auto start = std::chrono::steady_clock::now();
+	compute();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Times every method on random operands of growing sizes (in 64-bit limbs), where the chosen one is used
+// at the top level only, so the sizes, from which a method becomes faster, are the thresholds of BigInteger
+void benchmark() {
+	using Method = BigInteger::Multiplication;
+	std::mt19937_64 engine(2024);
+	std::cout << std::setw(8) << "Limbs" << std::setw(14) << "Schoolbook" << std::setw(14) << "Karatsuba"
+		<< std::setw(14) << "Toom-3" << std::setw(14) << "Automatic" << "   (microseconds per product)" << std::endl;
+	for (size_t limbs : { 8, 16, 24, 32, 64, 128, 256, 320, 512, 1024, 2048, 4096 }) {
+		std::vector<uint64_t> first(limbs), second(limbs);
+		for (size_t i = 0; i < limbs; i++) {
+			first[i] = engine();
+			second[i] = engine();
+		}
+		BigInteger a = BigInteger::fromLimbs(first), b = BigInteger::fromLimbs(second);
+		int repeats = static_cast<int>(std::max<size_t>(2, 4000000 / (limbs * limbs)));
+		BigInteger products[4];
+		std::cout << std::setw(8) << limbs << std::fixed << std::setprecision(2);
+		int index = 0;
+		for (Method method : { Method::Schoolbook, Method::Karatsuba, Method::ToomCook3, Method::Automatic }) {
+			double time = milliseconds([&]() {
+				for (int r = 0; r < repeats; r++) { products[index] = BigInteger::multiply(a, b, method); }
+			});
+			std::cout << std::setw(14) << time * 1000 / repeats;
+			index++;
+		}
+		bool same = products[0] == products[1] && products[0] == products[2] && products[0] == products[3];
+		std::cout << (same ? "   (same)" : "   (different!)") << std::endl;
+	}
+}
+
 int main() {
 	// Greet
 	std::cout << "\tWelcome to the 'Karatsuba Algorithm' console application!\n\n";
@@ -21,11 +65,29 @@ int main() {
 	std::cin >> b;
 
 	// Demonstrate
-	std::cout << "Result: " << karatsuba(a, b) << std::endl << std::endl;
+	std::cout << "Result: " << karatsuba(a, b) << std::endl;
+	std::cout << "Exact result: " << karatsuba(BigInteger(std::to_string(a)), BigInteger(std::to_string(b))).toString()
+		<< std::endl << std::endl;
+
+	// Multiply numbers of any size
+	std::cout << "Big number #1 to multiply (any number of digits): ";
+	std::string first;
+	std::cin >> first;
+	std::cout << "Big number #2 to multiply (any number of digits): ";
+	std::string second;
+	std::cin >> second;
+	std::cout << "Result: " << (BigInteger(first) * BigInteger(second)).toString() << std::endl << std::endl;
+
+	// Compare the methods
+	std::cout << "Run the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) { benchmark(); }
 
 	// Exit
-	std::cout << "Thanks for using this program! Have a great day!\n";
+	std::cout << "\nThanks for using this program! Have a great day!\n";
 	std::cout << "Press <Enter> to exit...";
+	std::cin.ignore();
 	std::cin.get();
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,23 @@
+// Title:   Header file for Matrix Multiplication (GEMM)
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef MATRIX_MULTIPLICATION_H
+#define MATRIX_MULTIPLICATION_H
+
+
+#include <cstdint>
+
+
+// C = A * B for row-major matrices, where A is m x k, B is k x n and C is m x n, and every one
+// is given by the pointer to its first element and the distance between its rows (lda, ldb, ldc);
+// blocks of A and B are packed into contiguous buffers, which stay in the caches, and a small block
+// of C stays in registers, while the rows of C are split between 'threads' threads
+void gemm(int m, int n, int k, const float* A, int lda, const float* B, int ldb, float* C, int ldc, int threads = 1);
+void gemm(int m, int n, int k, const double* A, int lda, const double* B, int ldb, double* C, int ldc, int threads = 1);
+void gemm(int m, int n, int k, const int32_t* A, int lda, const int32_t* B, int ldb, int32_t* C, int ldc, int threads = 1);
+
+
+#endif // MATRIX_MULTIPLICATION_H
\ No newline at end of file
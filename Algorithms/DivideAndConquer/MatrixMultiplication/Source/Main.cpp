@@ -0,0 +1,123 @@
+// Title:   Matrix Multiplication (GEMM) Algorithm
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <thread>
+#include "MatrixMultiplication.h"
+
+
+// Textbook triple loop in the order, which keeps the innermost loop contiguous
+template <typename Element>
+void naiveMultiplication(int n, const Element* A, const Element* B, Element* C) {
+	for (int i = 0; i < n * n; i++) { C[i] = 0; }
+	for (int i = 0; i < n; i++) {
+		for (int k = 0; k < n; k++) {
+			for (int j = 0; j < n; j++) { C[i * n + j] += A[i * n + k] * B[k * n + j]; }
+		}
+	}
+}
+
+template <typename Element>
+void printMatrix(const std::vector<Element>& matrix, int rows, int columns) {
+	for (int i = 0; i < rows; i++) {
+		for (int j = 0; j < columns; j++) { std::cout << " " << matrix[i * columns + j] << "\t"; }
+		std::cout << std::endl;
+	}
+	std::cout << std::endl;
+}
+
+// Multiplies random n x n matrices (of small integers, so that all types give exact results)
+// and prints GFLOP/s, i.e. billions of multiplications and additions per second
+template <typename Element>
+void measure(const std::string& name, int n, int threads, bool compare) {
+	std::mt19937 engine(2026);
+	std::vector<Element> A(n * n), B(n * n), C(n * n), expected(n * n);
+	for (int i = 0; i < n * n; i++) {
+		A[i] = static_cast<Element>(static_cast<int>(engine() % 21) - 10);
+		B[i] = static_cast<Element>(static_cast<int>(engine() % 21) - 10);
+	}
+	auto start = std::chrono::steady_clock::now();
+	gemm(n, n, n, A.data(), n, B.data(), n, C.data(), n, threads);
+	auto end = std::chrono::steady_clock::now();
+	double seconds = std::chrono::duration<double>(end - start).count();
+	std::cout << std::setw(8) << name << std::setw(8) << n << std::setw(10) << threads
+		<< std::fixed << std::setprecision(1) << std::setw(12) << 2.0 * n * n * n / seconds / 1e9;
+
+	if (compare) {
+		start = std::chrono::steady_clock::now();
+		naiveMultiplication(n, A.data(), B.data(), expected.data());
+		end = std::chrono::steady_clock::now();
+		seconds = std::chrono::duration<double>(end - start).count();
+		std::cout << std::setw(12) << 2.0 * n * n * n / seconds / 1e9 << (C == expected ? "   (same)" : "   (different!)");
+	}
+	std::cout << std::endl;
+}
+
+// Compares the types, sizes and numbers of threads
+void benchmark() {
+	int cores = std::max(1u, std::thread::hardware_concurrency());
+	std::cout << std::setw(8) << "Type" << std::setw(8) << "Size" << std::setw(10) << "Threads"
+		<< std::setw(12) << "GEMM" << std::setw(12) << "Naive" << "   (GFLOP/s)" << std::endl;
+	for (int n : { 256, 512, 1024, 2048 }) {
+		measure<float>("float", n, 1, n <= 1024);
+		measure<double>("double", n, 1, n <= 1024);
+		measure<int32_t>("int32", n, 1, n <= 1024);
+	}
+	if (cores > 1) {
+		measure<float>("float", 2048, cores, false);
+		measure<double>("double", 2048, cores, false);
+		measure<int32_t>("int32", 2048, cores, false);
+	}
+}
+
+int main() {
+	// Greet
+	std::cout << "\tWelcome to the 'Matrix Multiplication (GEMM)' console application!\n\n";
+
+	// Create initial matrices, which are not multiples of the blocks
+	const int m = 3, k = 4, n = 5;
+	std::vector<double> A(m * k), B(k * n), C(m * n);
+	for (int i = 0; i < m * k; i++) { A[i] = i + 1; }
+	for (int i = 0; i < k * n; i++) { B[i] = i % 3 - 1; }
+	std::cout << "Creating initial matrix A (3x4):" << std::endl;
+	printMatrix(A, m, k);
+	std::cout << "Creating initial matrix B (4x5):" << std::endl;
+	printMatrix(B, k, n);
+
+	// Multiply and display the result
+	std::cout << "Their product:" << std::endl;
+	gemm(m, n, k, A.data(), k, B.data(), n, C.data(), n);
+	printMatrix(C, m, n);
+
+	// Multiply big matrices
+	std::cout << "Enter the size of square matrices (e.g. 1024): ";
+	int size = 0;
+	std::cin >> size;
+	std::cout << "Enter the number of threads (this machine has " << std::thread::hardware_concurrency() << "): ";
+	int threads = 1;
+	std::cin >> threads;
+	std::cout << std::setw(8) << "Type" << std::setw(8) << "Size" << std::setw(10) << "Threads"
+		<< std::setw(12) << "GEMM" << "   (GFLOP/s)" << std::endl;
+	measure<float>("float", size, threads, false);
+
+	// Compare the types and sizes
+	std::cout << "\nRun the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) { benchmark(); }
+
+	// Exit
+	std::cout << "\nThanks for using this program! Have a great day!\n";
+	std::cout << "Press <Enter> to exit...";
+	std::cin.ignore();
+	std::cin.get();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,308 @@
+// Title:   Source file for Matrix Multiplication (GEMM)
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "MatrixMultiplication.h"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include <thread>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+// Sizes of the blocks for every element type: kernelRows x kernelColumns of C stay in registers,
+// depthBlock x kernelColumns of packed B - in L1, rowsBlock x depthBlock of packed A - in L2,
+// and depthBlock x columnsBlock of packed B - in L3
+template <typename Element>
+struct Blocking {
+	static constexpr int kernelRows = 6;
+	static constexpr int kernelColumns = 16;
+	static constexpr int depthBlock = 256;
+	static constexpr int rowsBlock = 120;
+	static constexpr int columnsBlock = 3072;
+};
+
+template <>
+struct Blocking<double> {
+	static constexpr int kernelRows = 6;
+	static constexpr int kernelColumns = 8;
+	static constexpr int depthBlock = 256;
+	static constexpr int rowsBlock = 96;
+	static constexpr int columnsBlock = 3072;
+};
+
+
+// -------------
+// Micro-Kernels
+// -------------
+
+// c += a * b for a block of kernelRows x kernelColumns, where a holds 'depth' columns of kernelRows elements
+// and b holds 'depth' rows of kernelColumns elements, one after another, as they were packed
+template <typename Element>
+static void microKernel(int depth, const Element* a, const Element* b, Element* c, int ldc) {
+	const int rows = Blocking<Element>::kernelRows;
+	const int columns = Blocking<Element>::kernelColumns;
+	Element sums[rows][columns] = {};
+	for (int p = 0; p < depth; p++, a += rows, b += columns) {
+		for (int r = 0; r < rows; r++) {
+			for (int j = 0; j < columns; j++) { sums[r][j] += a[r] * b[j]; }
+		}
+	}
+	for (int r = 0; r < rows; r++) {
+		for (int j = 0; j < columns; j++) { c[static_cast<ptrdiff_t>(r) * ldc + j] += sums[r][j]; }
+	}
+}
+
+#if defined(__AVX2__) && defined(__FMA__)
+// Adds two registers to a row of C
+static void addRow(float* row, __m256 low, __m256 high) {
+	_mm256_storeu_ps(row, _mm256_add_ps(_mm256_loadu_ps(row), low));
+	_mm256_storeu_ps(row + 8, _mm256_add_ps(_mm256_loadu_ps(row + 8), high));
+}
+
+static void addRow(double* row, __m256d low, __m256d high) {
+	_mm256_storeu_pd(row, _mm256_add_pd(_mm256_loadu_pd(row), low));
+	_mm256_storeu_pd(row + 4, _mm256_add_pd(_mm256_loadu_pd(row + 4), high));
+}
+
+// 6 x 16 floats: each row of C is kept in two registers, and each step multiplies one broadcast element
+// of A by two registers of B, so twelve independent accumulators hide the latency of FMA;
+// the rows are written out by hand, as loops over them are not always unrolled and the sums are spilled
+template <>
+void microKernel<float>(int depth, const float* a, const float* b, float* c, int ldc) {
+	__m256 c00 = _mm256_setzero_ps(), c01 = c00, c10 = c00, c11 = c00, c20 = c00, c21 = c00;
+	__m256 c30 = c00, c31 = c00, c40 = c00, c41 = c00, c50 = c00, c51 = c00;
+	for (int p = 0; p < depth; p++, a += 6, b += 16) {
+		__m256 low = _mm256_loadu_ps(b);
+		__m256 high = _mm256_loadu_ps(b + 8);
+		__m256 element;
+		element = _mm256_broadcast_ss(a);
+		c00 = _mm256_fmadd_ps(element, low, c00);
+		c01 = _mm256_fmadd_ps(element, high, c01);
+		element = _mm256_broadcast_ss(a + 1);
+		c10 = _mm256_fmadd_ps(element, low, c10);
+		c11 = _mm256_fmadd_ps(element, high, c11);
+		element = _mm256_broadcast_ss(a + 2);
+		c20 = _mm256_fmadd_ps(element, low, c20);
+		c21 = _mm256_fmadd_ps(element, high, c21);
+		element = _mm256_broadcast_ss(a + 3);
+		c30 = _mm256_fmadd_ps(element, low, c30);
+		c31 = _mm256_fmadd_ps(element, high, c31);
+		element = _mm256_broadcast_ss(a + 4);
+		c40 = _mm256_fmadd_ps(element, low, c40);
+		c41 = _mm256_fmadd_ps(element, high, c41);
+		element = _mm256_broadcast_ss(a + 5);
+		c50 = _mm256_fmadd_ps(element, low, c50);
+		c51 = _mm256_fmadd_ps(element, high, c51);
+	}
+	addRow(c, c00, c01);
+	addRow(c + ldc, c10, c11);
+	addRow(c + 2 * static_cast<ptrdiff_t>(ldc), c20, c21);
+	addRow(c + 3 * static_cast<ptrdiff_t>(ldc), c30, c31);
+	addRow(c + 4 * static_cast<ptrdiff_t>(ldc), c40, c41);
+	addRow(c + 5 * static_cast<ptrdiff_t>(ldc), c50, c51);
+}
+
+// 6 x 8 doubles in the same way
+template <>
+void microKernel<double>(int depth, const double* a, const double* b, double* c, int ldc) {
+	__m256d c00 = _mm256_setzero_pd(), c01 = c00, c10 = c00, c11 = c00, c20 = c00, c21 = c00;
+	__m256d c30 = c00, c31 = c00, c40 = c00, c41 = c00, c50 = c00, c51 = c00;
+	for (int p = 0; p < depth; p++, a += 6, b += 8) {
+		__m256d low = _mm256_loadu_pd(b);
+		__m256d high = _mm256_loadu_pd(b + 4);
+		__m256d element;
+		element = _mm256_broadcast_sd(a);
+		c00 = _mm256_fmadd_pd(element, low, c00);
+		c01 = _mm256_fmadd_pd(element, high, c01);
+		element = _mm256_broadcast_sd(a + 1);
+		c10 = _mm256_fmadd_pd(element, low, c10);
+		c11 = _mm256_fmadd_pd(element, high, c11);
+		element = _mm256_broadcast_sd(a + 2);
+		c20 = _mm256_fmadd_pd(element, low, c20);
+		c21 = _mm256_fmadd_pd(element, high, c21);
+		element = _mm256_broadcast_sd(a + 3);
+		c30 = _mm256_fmadd_pd(element, low, c30);
+		c31 = _mm256_fmadd_pd(element, high, c31);
+		element = _mm256_broadcast_sd(a + 4);
+		c40 = _mm256_fmadd_pd(element, low, c40);
+		c41 = _mm256_fmadd_pd(element, high, c41);
+		element = _mm256_broadcast_sd(a + 5);
+		c50 = _mm256_fmadd_pd(element, low, c50);
+		c51 = _mm256_fmadd_pd(element, high, c51);
+	}
+	addRow(c, c00, c01);
+	addRow(c + ldc, c10, c11);
+	addRow(c + 2 * static_cast<ptrdiff_t>(ldc), c20, c21);
+	addRow(c + 3 * static_cast<ptrdiff_t>(ldc), c30, c31);
+	addRow(c + 4 * static_cast<ptrdiff_t>(ldc), c40, c41);
+	addRow(c + 5 * static_cast<ptrdiff_t>(ldc), c50, c51);
+}
+#endif
+
+#if defined(__AVX2__)
+static void addRow(int32_t* row, __m256i low, __m256i high) {
+	__m256i* vectors = reinterpret_cast<__m256i*>(row);
+	_mm256_storeu_si256(vectors, _mm256_add_epi32(_mm256_loadu_si256(vectors), low));
+	_mm256_storeu_si256(vectors + 1, _mm256_add_epi32(_mm256_loadu_si256(vectors + 1), high));
+}
+
+// 6 x 16 integers, where a separate multiplication and addition replace FMA
+template <>
+void microKernel<int32_t>(int depth, const int32_t* a, const int32_t* b, int32_t* c, int ldc) {
+	__m256i c00 = _mm256_setzero_si256(), c01 = c00, c10 = c00, c11 = c00, c20 = c00, c21 = c00;
+	__m256i c30 = c00, c31 = c00, c40 = c00, c41 = c00, c50 = c00, c51 = c00;
+	for (int p = 0; p < depth; p++, a += 6, b += 16) {
+		__m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+		__m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + 8));
+		__m256i element;
+		element = _mm256_set1_epi32(a[0]);
+		c00 = _mm256_add_epi32(c00, _mm256_mullo_epi32(element, low));
+		c01 = _mm256_add_epi32(c01, _mm256_mullo_epi32(element, high));
+		element = _mm256_set1_epi32(a[1]);
+		c10 = _mm256_add_epi32(c10, _mm256_mullo_epi32(element, low));
+		c11 = _mm256_add_epi32(c11, _mm256_mullo_epi32(element, high));
+		element = _mm256_set1_epi32(a[2]);
+		c20 = _mm256_add_epi32(c20, _mm256_mullo_epi32(element, low));
+		c21 = _mm256_add_epi32(c21, _mm256_mullo_epi32(element, high));
+		element = _mm256_set1_epi32(a[3]);
+		c30 = _mm256_add_epi32(c30, _mm256_mullo_epi32(element, low));
+		c31 = _mm256_add_epi32(c31, _mm256_mullo_epi32(element, high));
+		element = _mm256_set1_epi32(a[4]);
+		c40 = _mm256_add_epi32(c40, _mm256_mullo_epi32(element, low));
+		c41 = _mm256_add_epi32(c41, _mm256_mullo_epi32(element, high));
+		element = _mm256_set1_epi32(a[5]);
+		c50 = _mm256_add_epi32(c50, _mm256_mullo_epi32(element, low));
+		c51 = _mm256_add_epi32(c51, _mm256_mullo_epi32(element, high));
+	}
+	addRow(c, c00, c01);
+	addRow(c + ldc, c10, c11);
+	addRow(c + 2 * static_cast<ptrdiff_t>(ldc), c20, c21);
+	addRow(c + 3 * static_cast<ptrdiff_t>(ldc), c30, c31);
+	addRow(c + 4 * static_cast<ptrdiff_t>(ldc), c40, c41);
+	addRow(c + 5 * static_cast<ptrdiff_t>(ldc), c50, c51);
+}
+#endif
+
+
+// -------
+// Packing
+// -------
+
+// Rows [0, rows) and columns [0, depth) of A go into strips of kernelRows rows, column after column,
+// where missing rows of the last strip are zeros
+template <typename Element>
+static void packA(int rows, int depth, const Element* A, int lda, Element* packed) {
+	const int kernelRows = Blocking<Element>::kernelRows;
+	for (int i = 0; i < rows; i += kernelRows) {
+		int height = std::min(kernelRows, rows - i);
+		for (int p = 0; p < depth; p++) {
+			for (int r = 0; r < kernelRows; r++) { *packed++ = r < height ? A[static_cast<ptrdiff_t>(i + r) * lda + p] : Element(0); }
+		}
+	}
+}
+
+// Rows [0, depth) and columns [0, columns) of B go into strips of kernelColumns columns, row after row
+template <typename Element>
+static void packB(int depth, int columns, const Element* B, int ldb, Element* packed) {
+	const int kernelColumns = Blocking<Element>::kernelColumns;
+	for (int j = 0; j < columns; j += kernelColumns) {
+		int width = std::min(kernelColumns, columns - j);
+		for (int p = 0; p < depth; p++) {
+			const Element* row = B + static_cast<ptrdiff_t>(p) * ldb + j;
+			for (int col = 0; col < kernelColumns; col++) { *packed++ = col < width ? row[col] : Element(0); }
+		}
+	}
+}
+
+
+// -----------
+// Multiplying
+// -----------
+
+static int roundUp(int value, int multiple) {
+	return (value + multiple - 1) / multiple * multiple;
+}
+
+// Loops around the micro-kernel: columns of C by columnsBlock, the common dimension by depthBlock
+// (packing B), rows by rowsBlock (packing A), and then the blocks of registers inside them;
+// blocks on the edges are computed into a buffer and only their valid part is added to C
+template <typename Element>
+static void multiplySerial(int m, int n, int k, const Element* A, int lda, const Element* B, int ldb, Element* C, int ldc) {
+	using Sizes = Blocking<Element>;
+	const int kernelRows = Sizes::kernelRows;
+	const int kernelColumns = Sizes::kernelColumns;
+	// Buffers only as big as these matrices need, which matters when small ones are multiplied many times
+	int depthNeeded = std::min(k, Sizes::depthBlock);
+	std::vector<Element> packedA(roundUp(std::min(m, Sizes::rowsBlock), kernelRows) * depthNeeded);
+	std::vector<Element> packedB(roundUp(std::min(n, Sizes::columnsBlock), kernelColumns) * depthNeeded);
+	Element edge[kernelRows * kernelColumns];
+
+	for (int i = 0; i < m; i++) { std::fill(C + static_cast<ptrdiff_t>(i) * ldc, C + static_cast<ptrdiff_t>(i) * ldc + n, Element(0)); }
+	for (int jc = 0; jc < n; jc += Sizes::columnsBlock) {
+		int columns = std::min(Sizes::columnsBlock, n - jc);
+		for (int pc = 0; pc < k; pc += Sizes::depthBlock) {
+			int depth = std::min(Sizes::depthBlock, k - pc);
+			packB(depth, columns, B + static_cast<ptrdiff_t>(pc) * ldb + jc, ldb, packedB.data());
+			for (int ic = 0; ic < m; ic += Sizes::rowsBlock) {
+				int rows = std::min(Sizes::rowsBlock, m - ic);
+				packA(rows, depth, A + static_cast<ptrdiff_t>(ic) * lda + pc, lda, packedA.data());
+				for (int jr = 0; jr < columns; jr += kernelColumns) {
+					int width = std::min(kernelColumns, columns - jr);
+					for (int ir = 0; ir < rows; ir += kernelRows) {
+						int height = std::min(kernelRows, rows - ir);
+						const Element* a = packedA.data() + ir * depth;
+						const Element* b = packedB.data() + jr * depth;
+						Element* c = C + static_cast<ptrdiff_t>(ic + ir) * ldc + jc + jr;
+						if (height == kernelRows && width == kernelColumns) {
+							microKernel(depth, a, b, c, ldc);
+							continue;
+						}
+						std::fill(edge, edge + kernelRows * kernelColumns, Element(0));
+						microKernel(depth, a, b, edge, kernelColumns);
+						for (int r = 0; r < height; r++) {
+							for (int col = 0; col < width; col++) { c[static_cast<ptrdiff_t>(r) * ldc + col] += edge[r * kernelColumns + col]; }
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+// Every thread gets its own band of rows of C (a multiple of kernelRows) with its own packing buffers
+template <typename Element>
+static void multiply(int m, int n, int k, const Element* A, int lda, const Element* B, int ldb, Element* C, int ldc, int threads) {
+	const int kernelRows = Blocking<Element>::kernelRows;
+	int strips = (m + kernelRows - 1) / kernelRows;
+	threads = std::max(1, std::min(threads, strips));
+	if (threads == 1) {
+		multiplySerial(m, n, k, A, lda, B, ldb, C, ldc);
+		return;
+	}
+
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; t++) {
+		int first = strips * t / threads * kernelRows;
+		int last = std::min(m, strips * (t + 1) / threads * kernelRows);
+		workers.emplace_back(multiplySerial<Element>, last - first, n, k, A + static_cast<ptrdiff_t>(first) * lda, lda, B, ldb, C + static_cast<ptrdiff_t>(first) * ldc, ldc);
+	}
+	for (std::thread& worker : workers) { worker.join(); }
+}
+
+void gemm(int m, int n, int k, const float* A, int lda, const float* B, int ldb, float* C, int ldc, int threads) {
+	multiply(m, n, k, A, lda, B, ldb, C, ldc, threads);
+}
+
+void gemm(int m, int n, int k, const double* A, int lda, const double* B, int ldb, double* C, int ldc, int threads) {
+	multiply(m, n, k, A, lda, B, ldb, C, ldc, threads);
+}
+
+void gemm(int m, int n, int k, const int32_t* A, int lda, const int32_t* B, int ldb, int32_t* C, int ldc, int threads) {
+	multiply(m, n, k, A, lda, B, ldb, C, ldc, threads);
+}
\ No newline at end of file
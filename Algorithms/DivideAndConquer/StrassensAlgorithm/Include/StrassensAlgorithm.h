@@ -8,6 +8,11 @@
 #define STRASSENS_H
 
 
+#include <vector>
+#include <cstddef>
+#include "TaskPool.h"
+
+
 using Matrix = std::vector<std::vector<int>>;
 
 
@@ -16,4 +21,95 @@ Matrix subtractMatrices(const Matrix& A, const Matrix& B);
 Matrix strassensAlgorithm(const Matrix& A, const Matrix& B);
 
 
+// -------------
+// Flat Matrices
+// -------------
+
+// Matrix stored in a single array row after row, so that a row is contiguous and any block
+// of it is reachable through a pointer and the distance between rows
+class FlatMatrix {
+private:
+	int rowsCount;
+	int columnsCount;
+	std::vector<int> elements;
+
+public:
+	FlatMatrix(int rows = 0, int columns = 0);
+	explicit FlatMatrix(const Matrix& matrix);
+
+	int rows() const { return rowsCount; }
+	int columns() const { return columnsCount; }
+	int* operator[](int row) { return elements.data() + static_cast<ptrdiff_t>(row) * columnsCount; }
+	const int* operator[](int row) const { return elements.data() + static_cast<ptrdiff_t>(row) * columnsCount; }
+	bool operator==(const FlatMatrix& other) const;
+
+	Matrix toMatrix() const;
+};
+
+// Block of a flat matrix (or of a workspace), which is used in place instead of being copied
+template <typename Element>
+struct MatrixView {
+	Element* data;
+	int stride;   // Distance between the starts of neighbouring rows
+	int rows;
+	int columns;
+
+	Element* operator[](int row) const { return data + static_cast<ptrdiff_t>(row) * stride; }
+	operator MatrixView<const Element>() const { return { data, stride, rows, columns }; }
+
+	// Block of 'rowsCount' x 'columnsCount' elements, which starts at the given row and column
+	MatrixView block(int row, int column, int rowsCount, int columnsCount) const {
+		return { data + static_cast<ptrdiff_t>(row) * stride + column, stride, rowsCount, columnsCount };
+	}
+
+	// One of the four equal blocks of a matrix with even sizes, where 'row' and 'column' are 0 or 1
+	MatrixView quadrant(int row, int column) const {
+		int halfRows = rows / 2;
+		int halfColumns = columns / 2;
+		return { data + static_cast<ptrdiff_t>(row) * halfRows * stride + column * halfColumns, stride, halfRows, halfColumns };
+	}
+};
+
+using View = MatrixView<int>;
+using ConstView = MatrixView<const int>;
+
+View viewOf(FlatMatrix& matrix);
+ConstView viewOf(const FlatMatrix& matrix);
+
+// Classical multiplication C = A * B by blocks, which stay in the cache while they are reused
+void blockedMultiplication(ConstView A, ConstView B, View C);
+FlatMatrix blockedMultiplication(const FlatMatrix& A, const FlatMatrix& B);
+
+// Below this size the classical multiplication is faster than another level of recursion; compiling with
+// -DSTRASSEN_GEMM (and MatrixMultiplication from the neighbouring folder) makes it the much faster GEMM
+#if defined(STRASSEN_GEMM)
+const int strassenThreshold = 512;
+#else
+const int strassenThreshold = 64;
+#endif
+
+// Elements of the workspace, which Strassen's algorithm needs for A of m x k and B of k x n
+// (never more than n^2 for square matrices)
+size_t strassenWorkspaceSize(int m, int k, int n, int threshold = strassenThreshold);
+
+// Strassen's algorithm for views of any sizes (A is m x k and B is k x n), which keeps the sums and
+// the products of every level in the workspace, so nothing is allocated during the recursion;
+// even parts of the sizes are split into quadrants, while an odd last row, column or element
+// of the common dimension is peeled off and computed classically, as are the sizes, whose halves would drop below the threshold
+void strassensAlgorithm(ConstView A, ConstView B, View C, int* workspace, int threshold = strassenThreshold);
+FlatMatrix strassensAlgorithm(const FlatMatrix& A, const FlatMatrix& B, int threshold = strassenThreshold);
+
+
+// -----------------
+// Parallel Strassen
+// -----------------
+
+// Same algorithm, where the seven products of the top levels are tasks of the work-stealing pool:
+// as many levels as give every thread at least two products, but fewer, if the workspace (in elements)
+// would exceed 'workspaceLimit' (0 for no limit), and none for a single thread; the products
+// of the last parallel level borrow the workspace of the thread, which runs them, so it grows
+// with the number of threads rather than with the number of tasks
+FlatMatrix parallelStrassensAlgorithm(const FlatMatrix& A, const FlatMatrix& B, TaskPool& pool,
+	size_t workspaceLimit = 0, int threshold = strassenThreshold);
+
 #endif // STRASSENS_H
\ No newline at end of file
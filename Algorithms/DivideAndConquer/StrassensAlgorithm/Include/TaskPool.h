@@ -0,0 +1,71 @@
+// Title:   Header file for Task Pool
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// Work-stealing pool: every thread has its own queue, takes the newest task of it (which is the most
+// likely to be in the cache), and steals the oldest task of another queue (which is usually the biggest
+// one), when its own is empty; the thread, which created the pool, takes part in the work as queue 0,
+// while it waits for a group of tasks
+class TaskPool {
+private:
+	struct Queue {
+		std::mutex lock;
+		std::deque<std::function<void()>> tasks;
+	};
+
+	std::vector<std::unique_ptr<Queue>> queues;
+	std::vector<std::thread> workers;
+	std::atomic<int> queued;   // Tasks in all queues, so idle workers know when to wake up
+	std::atomic<bool> stopping;
+	std::mutex sleepLock;
+	std::condition_variable wakeUp;
+
+	void work(int index);
+	bool take(int index, std::function<void()>& task);
+
+public:
+	explicit TaskPool(int threads);
+	~TaskPool();
+	TaskPool(const TaskPool&) = delete;
+	TaskPool& operator=(const TaskPool&) = delete;
+
+	int size() const { return static_cast<int>(queues.size()); }
+	int index() const;   // Queue of the calling thread: 0 for the thread, which created the pool
+
+	void submit(std::function<void()> task);
+	bool runPending();   // Runs one task of any queue, returns false if there were none
+};
+
+// Tasks, which are waited for together; while waiting, the thread runs pending tasks instead of blocking,
+// so nested groups never deadlock and no thread stays idle
+class TaskGroup {
+private:
+	TaskPool& pool;
+	std::atomic<int> remaining;
+
+public:
+	explicit TaskGroup(TaskPool& taskPool) : pool(taskPool), remaining(0) {}
+	~TaskGroup() { wait(); }
+
+	void spawn(std::function<void()> task);
+	void wait();
+};
+
+
+#endif // TASK_POOL_H
\ No newline at end of file
@@ -5,7 +5,11 @@
 
 
 #include <iostream>
+#include <iomanip>
 #include <vector>
+#include <random>
+#include <chrono>
+#include <thread>
 #include "StrassensAlgorithm.h"
 
 using Matrix = std::vector<std::vector<int>>;
@@ -14,7 +18,7 @@ using Matrix = std::vector<std::vector<int>>;
 void printMatrix(const Matrix matrix) {
 	int n = matrix.size();
 	for (int i = 0; i < n; i++) {
-		for (int j = 0; j < n; j++) {
+		for (size_t j = 0; j < matrix[i].size(); j++) {
 			std::cout << " " << matrix[i][j] << "\t";
 		}
 		std::cout << std::endl;
@@ -35,6 +39,66 @@ Matrix standardAlgorithm(const Matrix& A, const Matrix& B) {
 	return C;
 }
 
+// Runs 'compute' and returns the elapsed milliseconds
+template <typename Compute>
+double milliseconds(Compute compute) {
+	auto start = std::chrono::steady_clock::now();
+	compute();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Fills the matrix with random numbers from -100 to 100
+void randomize(FlatMatrix& matrix, std::mt19937& engine) {
+	for (int i = 0; i < matrix.rows(); i++) {
+		for (int j = 0; j < matrix.columns(); j++) {
+			matrix[i][j] = static_cast<int>(engine() % 201) - 100;
+		}
+	}
+}
+
+// Compares the algorithms on random matrices of growing sizes (including ones, which are not powers of two),
+// skipping the slow ones for big sizes, and runs the parallel version with the given number of threads
+void benchmark(int threads) {
+	std::mt19937 engine(2024);
+	TaskPool pool(threads);
+	std::cout << std::setw(6) << "Size" << std::setw(12) << "Standard" << std::setw(12) << "Strassen's"
+		<< std::setw(12) << "Blocked" << std::setw(14) << "Flat Strassen" << std::setw(10) << "Parallel" << "   (ms)" << std::endl;
+	for (int n : { 128, 256, 512, 1000, 1024, 1500, 2048 }) {
+		FlatMatrix A(n, n), B(n, n);
+		randomize(A, engine);
+		randomize(B, engine);
+		Matrix standard, strassens;
+		FlatMatrix blocked, flatStrassens, parallel;
+		std::cout << std::setw(6) << n << std::fixed << std::setprecision(2);
+		if (n <= 512) { std::cout << std::setw(12) << milliseconds([&]() { standard = standardAlgorithm(A.toMatrix(), B.toMatrix()); }); }
+		else { std::cout << std::setw(12) << "-"; }
+		if (n <= 128) { std::cout << std::setw(12) << milliseconds([&]() { strassens = strassensAlgorithm(A.toMatrix(), B.toMatrix()); }); }
+		else { std::cout << std::setw(12) << "-"; }
+		std::cout << std::setw(12) << milliseconds([&]() { blocked = blockedMultiplication(A, B); });
+		std::cout << std::setw(14) << milliseconds([&]() { flatStrassens = strassensAlgorithm(A, B); });
+		std::cout << std::setw(10) << milliseconds([&]() { parallel = parallelStrassensAlgorithm(A, B, pool); });
+		bool same = blocked == flatStrassens && blocked == parallel
+			&& (n > 512 || FlatMatrix(standard) == blocked) && (n > 128 || FlatMatrix(strassens) == blocked);
+		std::cout << (same ? "   (same)" : "   (different!)") << std::endl;
+	}
+
+	// Rectangular matrices, where every size is split on its own
+	std::cout << "\n" << std::setw(16) << "Sizes" << std::setw(12) << "Blocked" << std::setw(14) << "Flat Strassen"
+		<< std::setw(10) << "Parallel" << "   (ms)" << std::endl;
+	for (int scale : { 1, 2 }) {
+		int m = 777 * scale, k = 1200 * scale, n = 500 * scale;
+		FlatMatrix A(m, k), B(k, n), blocked, flatStrassens, parallel;
+		randomize(A, engine);
+		randomize(B, engine);
+		std::cout << std::setw(16) << std::to_string(m) + "x" + std::to_string(k) + "x" + std::to_string(n);
+		std::cout << std::setw(12) << milliseconds([&]() { blocked = blockedMultiplication(A, B); });
+		std::cout << std::setw(14) << milliseconds([&]() { flatStrassens = strassensAlgorithm(A, B); });
+		std::cout << std::setw(10) << milliseconds([&]() { parallel = parallelStrassensAlgorithm(A, B, pool); });
+		std::cout << (blocked == flatStrassens && blocked == parallel ? "   (same)" : "   (different!)") << std::endl;
+	}
+}
+
 int main() {
 	// Greet
 	std::cout << "\tWelcome to the 'Strassen's Algorithm' console application!\n\n";
@@ -70,9 +134,42 @@ int main() {
 	Matrix ansStrassens = strassensAlgorithm(A, B);
 	printMatrix(ansStrassens);
 
+	// Multiply flat matrices in place, recursing down to 1x1 to show all the levels
+	std::cout << "Strassen's matrix multiplication on flat matrices:" << std::endl;
+	Matrix ansFlat = strassensAlgorithm(FlatMatrix(A), FlatMatrix(B), 1).toMatrix();
+	printMatrix(ansFlat);
+
+	// Multiply matrices, whose sizes are neither equal nor powers of two
+	Matrix C = {
+		{1, 2, 3},
+		{4, 5, 6},
+		{7, 8, 9}
+	};
+	Matrix D = {
+		{1, 0, 2, -1, 3},
+		{0, 1, -2, 4, 1},
+		{2, -1, 0, 1, 1}
+	};
+	std::cout << "Strassen's matrix multiplication of 3x3 and 3x5 matrices:" << std::endl;
+	Matrix ansRectangular = strassensAlgorithm(FlatMatrix(C), FlatMatrix(D), 1).toMatrix();
+	printMatrix(ansRectangular);
+
+	// Compare the algorithms
+	std::cout << "Run the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) {
+		std::cout << "Enter the number of threads for the parallel version (this machine has "
+			<< std::thread::hardware_concurrency() << "): ";
+		int threads = 1;
+		std::cin >> threads;
+		benchmark(threads);
+	}
+
 	// Exit
-	std::cout << "Thanks for using this program! Have a great day!\n";
+	std::cout << "\nThanks for using this program! Have a great day!\n";
 	std::cout << "Press <Enter> to exit...";
+	std::cin.ignore();
 	std::cin.get();
 	return 0;
 }
\ No newline at end of file
@@ -5,8 +5,13 @@
 
 
 #include <vector>
+#include <algorithm>
 #include "StrassensAlgorithm.h"
 
+#if defined(STRASSEN_GEMM)
+#include "MatrixMultiplication.h"
+#endif
+
 using Matrix = std::vector<std::vector<int>>;
 
 
@@ -90,4 +95,365 @@ Matrix strassensAlgorithm(const Matrix& A, const Matrix& B) {
 
         return C;
     }
+}
+
+
+// -------------
+// Flat Matrices
+// -------------
+
+FlatMatrix::FlatMatrix(int rows, int columns)
+    : rowsCount(rows), columnsCount(columns), elements(static_cast<size_t>(rows) * columns, 0) {}
+
+FlatMatrix::FlatMatrix(const Matrix& matrix)
+    : FlatMatrix(static_cast<int>(matrix.size()), matrix.empty() ? 0 : static_cast<int>(matrix[0].size())) {
+    for (int i = 0; i < rowsCount; i++) {
+        std::copy(matrix[i].begin(), matrix[i].end(), (*this)[i]);
+    }
+}
+
+bool FlatMatrix::operator==(const FlatMatrix& other) const {
+    return rowsCount == other.rowsCount && columnsCount == other.columnsCount && elements == other.elements;
+}
+
+Matrix FlatMatrix::toMatrix() const {
+    Matrix matrix(rowsCount);
+    for (int i = 0; i < rowsCount; i++) {
+        matrix[i].assign((*this)[i], (*this)[i] + columnsCount);
+    }
+    return matrix;
+}
+
+View viewOf(FlatMatrix& matrix) {
+    return { matrix[0], matrix.columns(), matrix.rows(), matrix.columns() };
+}
+
+ConstView viewOf(const FlatMatrix& matrix) {
+    return { matrix[0], matrix.columns(), matrix.rows(), matrix.columns() };
+}
+
+// Rows of C are accumulated from rows of B scaled by elements of A, which keeps the innermost loop
+// contiguous (so it's vectorized), while blocks of B are reused for all rows of A
+void blockedMultiplication(ConstView A, ConstView B, View C) {
+    const int blockSize = 64;
+    for (int i = 0; i < C.rows; i++) {
+        std::fill(C[i], C[i] + C.columns, 0);
+    }
+    for (int kk = 0; kk < A.columns; kk += blockSize) {
+        int kEnd = std::min(kk + blockSize, A.columns);
+        for (int jj = 0; jj < C.columns; jj += blockSize) {
+            int jEnd = std::min(jj + blockSize, C.columns);
+            for (int i = 0; i < C.rows; i++) {
+                int* row = C[i];
+                for (int k = kk; k < kEnd; k++) {
+                    int a = A[i][k];
+                    const int* b = B[k];
+                    for (int j = jj; j < jEnd; j++) {
+                        row[j] += a * b[j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+FlatMatrix blockedMultiplication(const FlatMatrix& A, const FlatMatrix& B) {
+    FlatMatrix C(A.rows(), B.columns());
+    blockedMultiplication(viewOf(A), viewOf(B), viewOf(C));
+    return C;
+}
+
+// Elementwise operations on views of equal sizes
+static void sum(ConstView X, ConstView Y, View out) {
+    for (int i = 0; i < out.rows; i++) {
+        for (int j = 0; j < out.columns; j++) {
+            out[i][j] = X[i][j] + Y[i][j];
+        }
+    }
+}
+
+static void difference(ConstView X, ConstView Y, View out) {
+    for (int i = 0; i < out.rows; i++) {
+        for (int j = 0; j < out.columns; j++) {
+            out[i][j] = X[i][j] - Y[i][j];
+        }
+    }
+}
+
+static void accumulate(View out, ConstView X) {
+    for (int i = 0; i < out.rows; i++) {
+        for (int j = 0; j < out.columns; j++) {
+            out[i][j] += X[i][j];
+        }
+    }
+}
+
+static void deduct(View out, ConstView X) {
+    for (int i = 0; i < out.rows; i++) {
+        for (int j = 0; j < out.columns; j++) {
+            out[i][j] -= X[i][j];
+        }
+    }
+}
+
+static void copy(View out, ConstView X) {
+    for (int i = 0; i < out.rows; i++) {
+        std::copy(X[i], X[i] + X.columns, out[i]);
+    }
+}
+
+// Sizes, at which the recursion stops: the halves would drop below the threshold, so sizes, which
+// aren't powers of two, end in leaves between the threshold and twice it, rather than far below it
+static bool isLeaf(int m, int k, int n, int threshold) {
+    int smallest = std::min({ m, k, n });
+    return smallest < 2 * threshold || smallest < 2;
+}
+
+static void leafMultiplication(ConstView A, ConstView B, View C) {
+#if defined(STRASSEN_GEMM)
+    gemm(C.rows, C.columns, A.columns, A.data, A.stride, B.data, B.stride, C.data, C.stride);
+#else
+    blockedMultiplication(A, B, C);
+#endif
+}
+
+// Computes what the quadrants miss, when some of the sizes are odd: adds the last column of A times
+// the last row of B to the even part of C, then computes the last column and the last row of C directly
+static void peel(ConstView A, ConstView B, View C) {
+    int m = A.rows, k = A.columns, n = B.columns;
+    int evenM = m & ~1, evenK = k & ~1, evenN = n & ~1;
+    if (evenK != k) {
+        for (int i = 0; i < evenM; i++) {
+            int a = A[i][k - 1];
+            for (int j = 0; j < evenN; j++) {
+                C[i][j] += a * B[k - 1][j];
+            }
+        }
+    }
+    if (evenN != n) {
+        for (int i = 0; i < m; i++) {
+            int value = 0;
+            for (int p = 0; p < k; p++) {
+                value += A[i][p] * B[p][n - 1];
+            }
+            C[i][n - 1] = value;
+        }
+    }
+    if (evenM != m) {
+        std::fill(C[m - 1], C[m - 1] + evenN, 0);
+        for (int p = 0; p < k; p++) {
+            int a = A[m - 1][p];
+            for (int j = 0; j < evenN; j++) {
+                C[m - 1][j] += a * B[p][j];
+            }
+        }
+    }
+}
+
+size_t strassenWorkspaceSize(int m, int k, int n, int threshold) {
+    if (isLeaf(m, k, n, threshold)) { return 0; }
+    size_t halfM = m / 2, halfK = k / 2, halfN = n / 2;
+    return halfM * halfK + halfK * halfN + halfM * halfN + strassenWorkspaceSize(m / 2, k / 2, n / 2, threshold);
+}
+
+// Every level takes three blocks from the workspace: S and T for sums of A's and B's quadrants, and P
+// for a product; the rest is passed on, which for square matrices needs (n/2)^2 at most, so n^2 are enough
+// overall; the products are written straight into the quadrants of C, where possible, or added to them from P
+void strassensAlgorithm(ConstView A, ConstView B, View C, int* workspace, int threshold) {
+    int m = A.rows, k = A.columns, n = B.columns;
+    if (isLeaf(m, k, n, threshold)) {
+        leafMultiplication(A, B, C);
+        return;
+    }
+
+    int halfM = m / 2, halfK = k / 2, halfN = n / 2;
+    View S = { workspace, halfK, halfM, halfK };
+    View T = { S.data + static_cast<ptrdiff_t>(halfM) * halfK, halfN, halfK, halfN };
+    View P = { T.data + static_cast<ptrdiff_t>(halfK) * halfN, halfN, halfM, halfN };
+    int* rest = P.data + static_cast<ptrdiff_t>(halfM) * halfN;
+
+    ConstView evenA = A.block(0, 0, 2 * halfM, 2 * halfK), evenB = B.block(0, 0, 2 * halfK, 2 * halfN);
+    View evenC = C.block(0, 0, 2 * halfM, 2 * halfN);
+    ConstView A11 = evenA.quadrant(0, 0), A12 = evenA.quadrant(0, 1), A21 = evenA.quadrant(1, 0), A22 = evenA.quadrant(1, 1);
+    ConstView B11 = evenB.quadrant(0, 0), B12 = evenB.quadrant(0, 1), B21 = evenB.quadrant(1, 0), B22 = evenB.quadrant(1, 1);
+    View C11 = evenC.quadrant(0, 0), C12 = evenC.quadrant(0, 1), C21 = evenC.quadrant(1, 0), C22 = evenC.quadrant(1, 1);
+
+    // P1 = (A11 + A22)(B11 + B22) goes to C11 and C22
+    sum(A11, A22, S);
+    sum(B11, B22, T);
+    strassensAlgorithm(S, T, C11, rest, threshold);
+    copy(C22, C11);
+
+    // P2 = (A21 + A22) B11 goes to C21 and from C22
+    sum(A21, A22, S);
+    strassensAlgorithm(S, B11, C21, rest, threshold);
+    deduct(C22, C21);
+
+    // P3 = A11 (B12 - B22) goes to C12 and C22
+    difference(B12, B22, T);
+    strassensAlgorithm(A11, T, C12, rest, threshold);
+    accumulate(C22, C12);
+
+    // P4 = A22 (B21 - B11) goes to C11 and C21
+    difference(B21, B11, T);
+    strassensAlgorithm(A22, T, P, rest, threshold);
+    accumulate(C11, P);
+    accumulate(C21, P);
+
+    // P5 = (A11 + A12) B22 goes from C11 and to C12
+    sum(A11, A12, S);
+    strassensAlgorithm(S, B22, P, rest, threshold);
+    deduct(C11, P);
+    accumulate(C12, P);
+
+    // P6 = (A21 - A11)(B11 + B12) goes to C22
+    difference(A21, A11, S);
+    sum(B11, B12, T);
+    strassensAlgorithm(S, T, P, rest, threshold);
+    accumulate(C22, P);
+
+    // P7 = (A12 - A22)(B21 + B22) goes to C11
+    difference(A12, A22, S);
+    sum(B21, B22, T);
+    strassensAlgorithm(S, T, P, rest, threshold);
+    accumulate(C11, P);
+
+    peel(A, B, C);
+}
+
+FlatMatrix strassensAlgorithm(const FlatMatrix& A, const FlatMatrix& B, int threshold) {
+    FlatMatrix C(A.rows(), B.columns());
+    std::vector<int> workspace(strassenWorkspaceSize(A.rows(), A.columns(), B.columns(), threshold));
+    strassensAlgorithm(viewOf(A), viewOf(B), viewOf(C), workspace.data(), threshold);
+    return C;
+}
+
+
+// -----------------
+// Parallel Strassen
+// -----------------
+
+// Operand of a product: 'first', or its sum with 'second' (sign 1), or their difference (sign -1)
+struct Operand {
+    ConstView first;
+    ConstView second;
+    int sign;
+};
+
+static Operand single(ConstView X) { return { X, X, 0 }; }
+
+// Computes the operand into the buffer, if it's a sum or a difference
+static ConstView prepare(const Operand& operand, View buffer) {
+    if (operand.sign == 0) { return operand.first; }
+    if (operand.sign > 0) { sum(operand.first, operand.second, buffer); }
+    else { difference(operand.first, operand.second, buffer); }
+    return buffer;
+}
+
+struct ParallelContext {
+    TaskPool& pool;
+    int* scratch;         // Workspaces of the threads for the products of the last parallel level
+    size_t scratchSize;   // Elements in each of them
+    int threshold;
+};
+
+// Workspace of the parallel levels: P4..P7 of every level (P1..P3 go straight into C), and the sums
+// of the products, which wait for their own tasks, so they can't be in the workspace of a thread
+static size_t parallelWorkspaceSize(int m, int k, int n, int levels, int threshold) {
+    if (levels == 0) { return 0; }
+    size_t halfM = m / 2, halfK = k / 2, halfN = n / 2;
+    size_t child = levels > 1 ? halfM * halfK + halfK * halfN + parallelWorkspaceSize(m / 2, k / 2, n / 2, levels - 1, threshold) : 0;
+    return 4 * halfM * halfN + 7 * child;
+}
+
+// Workspace of a thread: the sums and the serial recursion of one product of the last parallel level
+static size_t scratchSize(int m, int k, int n, int levels, int threshold) {
+    if (levels > 1) { return scratchSize(m / 2, k / 2, n / 2, levels - 1, threshold); }
+    size_t halfM = m / 2, halfK = k / 2, halfN = n / 2;
+    return halfM * halfK + halfK * halfN + strassenWorkspaceSize(m / 2, k / 2, n / 2, threshold);
+}
+
+// The seven products are independent tasks, so they run on different threads, after which they are combined:
+// P1, P2 and P3 are written to C11, C21 and C12, and the rest are added to them from the workspace
+static void parallelStrassen(ConstView A, ConstView B, View C, int* workspace, int levels, ParallelContext& context) {
+    int m = A.rows, k = A.columns, n = B.columns;
+    int halfM = m / 2, halfK = k / 2, halfN = n / 2;
+    ptrdiff_t areaA = static_cast<ptrdiff_t>(halfM) * halfK;
+    ptrdiff_t areaB = static_cast<ptrdiff_t>(halfK) * halfN;
+    ptrdiff_t areaC = static_cast<ptrdiff_t>(halfM) * halfN;
+    View P4 = { workspace, halfN, halfM, halfN };
+    View P5 = { workspace + areaC, halfN, halfM, halfN };
+    View P6 = { workspace + 2 * areaC, halfN, halfM, halfN };
+    View P7 = { workspace + 3 * areaC, halfN, halfM, halfN };
+    int* children = workspace + 4 * areaC;
+    ptrdiff_t childSize = areaA + areaB + static_cast<ptrdiff_t>(parallelWorkspaceSize(halfM, halfK, halfN, levels - 1, context.threshold));
+
+    ConstView evenA = A.block(0, 0, 2 * halfM, 2 * halfK), evenB = B.block(0, 0, 2 * halfK, 2 * halfN);
+    View evenC = C.block(0, 0, 2 * halfM, 2 * halfN);
+    ConstView A11 = evenA.quadrant(0, 0), A12 = evenA.quadrant(0, 1), A21 = evenA.quadrant(1, 0), A22 = evenA.quadrant(1, 1);
+    ConstView B11 = evenB.quadrant(0, 0), B12 = evenB.quadrant(0, 1), B21 = evenB.quadrant(1, 0), B22 = evenB.quadrant(1, 1);
+    View C11 = evenC.quadrant(0, 0), C12 = evenC.quadrant(0, 1), C21 = evenC.quadrant(1, 0), C22 = evenC.quadrant(1, 1);
+
+    // Products of the last parallel level take their sums and the rest from the workspace of the thread,
+    // as they never wait for other tasks, while the higher ones have their own blocks
+    TaskGroup group(context.pool);
+    auto product = [&](int index, Operand left, Operand right, View out) {
+        group.spawn([=, &context]() {
+            int* buffer = levels > 1 ? children + index * childSize
+                : context.scratch + context.pool.index() * static_cast<ptrdiff_t>(context.scratchSize);
+            ConstView X = prepare(left, { buffer, halfK, halfM, halfK });
+            ConstView Y = prepare(right, { buffer + areaA, halfN, halfK, halfN });
+            if (levels > 1) { parallelStrassen(X, Y, out, buffer + areaA + areaB, levels - 1, context); }
+            else { strassensAlgorithm(X, Y, out, buffer + areaA + areaB, context.threshold); }
+        });
+    };
+    product(0, { A11, A22, 1 }, { B11, B22, 1 }, C11);
+    product(1, { A21, A22, 1 }, single(B11), C21);
+    product(2, single(A11), { B12, B22, -1 }, C12);
+    product(3, single(A22), { B21, B11, -1 }, P4);
+    product(4, { A11, A12, 1 }, single(B22), P5);
+    product(5, { A21, A11, -1 }, { B11, B12, 1 }, P6);
+    product(6, { A12, A22, -1 }, { B21, B22, 1 }, P7);
+    group.wait();
+
+    // C22 = P1 - P2 + P3 + P6, C11 = P1 + P4 - P5 + P7, C12 = P3 + P5, C21 = P2 + P4
+    copy(C22, C11);
+    deduct(C22, C21);
+    accumulate(C22, C12);
+    accumulate(C22, P6);
+    accumulate(C11, P4);
+    deduct(C11, P5);
+    accumulate(C11, P7);
+    accumulate(C12, P5);
+    accumulate(C21, P4);
+
+    peel(A, B, C);
+}
+
+FlatMatrix parallelStrassensAlgorithm(const FlatMatrix& A, const FlatMatrix& B, TaskPool& pool, size_t workspaceLimit, int threshold) {
+    int m = A.rows(), k = A.columns(), n = B.columns();
+    int threads = pool.size();
+
+    // Levels, which give every thread at least two products, while the sizes can still be split
+    int levels = 0;
+    for (int tasks = 1, rows = m, depth = k, columns = n; threads > 1 && tasks < 2 * threads && !isLeaf(rows, depth, columns, threshold); tasks *= 7) {
+        levels++;
+        rows /= 2;
+        depth /= 2;
+        columns /= 2;
+    }
+    auto workspaceSize = [&](int count) {
+        return parallelWorkspaceSize(m, k, n, count, threshold) + threads * scratchSize(m, k, n, count, threshold);
+    };
+    while (levels > 0 && workspaceLimit != 0 && workspaceSize(levels) > workspaceLimit) {
+        levels--;
+    }
+    if (levels == 0) { return strassensAlgorithm(A, B, threshold); }
+
+    FlatMatrix C(m, n);
+    std::vector<int> workspace(workspaceSize(levels));
+    size_t shared = parallelWorkspaceSize(m, k, n, levels, threshold);
+    ParallelContext context = { pool, workspace.data() + shared, scratchSize(m, k, n, levels, threshold), threshold };
+    parallelStrassen(viewOf(A), viewOf(B), viewOf(C), workspace.data(), levels, context);
+    return C;
 }
\ No newline at end of file
@@ -0,0 +1,111 @@
+// Title:   Source file for Task Pool
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "TaskPool.h"
+
+
+// Pool and queue of the calling thread, set by the workers when they start
+static thread_local const TaskPool* currentPool = nullptr;
+static thread_local int currentIndex = 0;
+
+
+TaskPool::TaskPool(int threads) : queued(0), stopping(false) {
+    int count = threads < 1 ? 1 : threads;
+    for (int i = 0; i < count; i++) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (int i = 1; i < count; i++) {
+        workers.emplace_back(&TaskPool::work, this, i);
+    }
+}
+
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+int TaskPool::index() const {
+    return currentPool == this ? currentIndex : 0;
+}
+
+// The newest task of the own queue, otherwise the oldest one of the next non-empty queue
+bool TaskPool::take(int index, std::function<void()>& task) {
+    for (int i = 0; i < size(); i++) {
+        Queue& queue = *queues[(index + i) % size()];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if (queue.tasks.empty()) { continue; }
+        if (i == 0) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        queued--;
+        return true;
+    }
+    return false;
+}
+
+void TaskPool::work(int index) {
+    currentPool = this;
+    currentIndex = index;
+    std::function<void()> task;
+    while (true) {
+        if (take(index, task)) {
+            task();
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(sleepLock);
+        wakeUp.wait(guard, [&]() { return stopping || queued > 0; });
+        if (stopping && queued == 0) { return; }
+    }
+}
+
+void TaskPool::submit(std::function<void()> task) {
+    Queue& queue = *queues[index()];
+    {
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.tasks.push_back(std::move(task));
+        queued++;
+    }
+    // Taking the lock orders the new task before the check of a worker, which is about to sleep
+    { std::lock_guard<std::mutex> guard(sleepLock); }
+    wakeUp.notify_one();
+}
+
+bool TaskPool::runPending() {
+    std::function<void()> task;
+    if (!take(index(), task)) { return false; }
+    task();
+    return true;
+}
+
+
+// ----------
+// Task Group
+// ----------
+
+void TaskGroup::spawn(std::function<void()> task) {
+    remaining++;
+    pool.submit([this, task]() {
+        task();
+        remaining--;
+    });
+}
+
+void TaskGroup::wait() {
+    while (remaining > 0) {
+        if (!pool.runPending()) { std::this_thread::yield(); }
+    }
+}
\ No newline at end of file
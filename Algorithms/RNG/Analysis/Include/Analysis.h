@@ -0,0 +1,67 @@
+// Title:   Header file for Analysis
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef ANALYSIS_H
+#define ANALYSIS_H
+
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+
+// Every test reads 32-bit words from a source, which fills a buffer of the given size;
+// this way the tests don't depend on the generator or on the size of its output
+using Source = std::function<void(uint32_t* out, size_t count)>;
+
+struct TestResult {
+	double statistic;   // Chi-square value
+	int degrees;        // Degrees of freedom
+	double pValue;      // Probability of at least the same statistic for a perfect generator
+};
+
+struct Throughput {
+	double gigabytesPerSecond;
+	double cyclesPerNumber;       // Time-stamp counter ticks, negative if there is no counter
+};
+
+
+// Results with p-value outside [significance, 1 - significance] are failures: too far from
+// the expected counts, or too close to them to be random
+const double significance = 1e-4;
+bool passed(const TestResult& result);
+
+// Upper tail of the chi-square distribution, i.e. the regularized incomplete gamma function Q
+double chiSquarePValue(double statistic, int degrees);
+
+
+// ----------
+// Test Suite
+// ----------
+
+// Counts of every byte value at each of the four positions in 'count' words
+TestResult frequencyTest(const Source& source, size_t count);
+
+// Counts of pairs of consecutive words, by their high bytes and by their low bytes
+TestResult serialTest(const Source& source, size_t count);
+
+// Lengths of the gaps between words that fall into [0, 1/8) when read as fractions
+TestResult gapTest(const Source& source, size_t count);
+
+// Marsaglia's birthday spacings: 512 birthdays in a year of 2^24 days, from the high and
+// from the low bits, where repeated spacings must follow the Poisson distribution with mean 2
+TestResult birthdaySpacingsTest(const Source& source, int samples);
+
+
+// ----------
+// Throughput
+// ----------
+
+// Generates 'count' words in blocks, 'wordBytes' is the size of one number of the generator
+Throughput measureThroughput(const Source& source, size_t count, int wordBytes);
+
+
+#endif // ANALYSIS_H
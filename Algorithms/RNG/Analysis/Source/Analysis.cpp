@@ -0,0 +1,225 @@
+// Title:   Source file for Analysis
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "Analysis.h"
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+static uint64_t cycles() { return __rdtsc(); }
+static const bool hasCycleCounter = true;
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static uint64_t cycles() { return __rdtsc(); }
+static const bool hasCycleCounter = true;
+#else
+static uint64_t cycles() { return 0; }
+static const bool hasCycleCounter = false;
+#endif
+
+// Keeps the generation from being optimized out
+static volatile uint32_t sink;
+
+
+// Hands out the words of the source one by one, while requesting them in large blocks
+class Reader {
+private:
+	const Source& source;
+	std::vector<uint32_t> block;
+	size_t position;
+
+public:
+	explicit Reader(const Source& words) : source(words), block(1 << 16), position(block.size()) {}
+	uint32_t next() {
+		if (position == block.size()) {
+			source(block.data(), block.size());
+			position = 0;
+		}
+		return block[position++];
+	}
+};
+
+// Sum of (observed - expected)^2 / expected over all categories
+static double chiSquare(const std::vector<uint64_t>& observed, const std::vector<double>& expected) {
+	double sum = 0;
+	for (size_t i = 0; i < observed.size(); i++) {
+		double difference = static_cast<double>(observed[i]) - expected[i];
+		sum += difference * difference / expected[i];
+	}
+	return sum;
+}
+
+static TestResult result(double statistic, int degrees) {
+	return { statistic, degrees, chiSquarePValue(statistic, degrees) };
+}
+
+
+bool passed(const TestResult& result) {
+	return result.pValue >= significance && result.pValue <= 1.0 - significance;
+}
+
+// Q(a, x) with a = degrees / 2 and x = statistic / 2: the power series gives the lower part P
+// for x < a + 1, otherwise the continued fraction gives Q directly (evaluated by Lentz's method)
+double chiSquarePValue(double statistic, int degrees) {
+	double a = degrees / 2.0;
+	double x = statistic / 2.0;
+	if (x <= 0) { return 1.0; }
+	double prefix = std::exp(a * std::log(x) - x - std::lgamma(a));
+
+	if (x < a + 1) {
+		double term = 1.0 / a;
+		double sum = term;
+		for (int n = 1; n < 1000000 && term > sum * 1e-15; n++) {
+			term *= x / (a + n);
+			sum += term;
+		}
+		return std::max(0.0, 1.0 - sum * prefix);
+	}
+
+	const double tiny = 1e-300;
+	double b = x + 1 - a;
+	double c = 1 / tiny;
+	double d = 1 / b;
+	double h = d;
+	for (int n = 1; n < 1000000; n++) {
+		double an = -n * (n - a);
+		b += 2;
+		d = an * d + b;
+		if (std::fabs(d) < tiny) { d = tiny; }
+		c = b + an / c;
+		if (std::fabs(c) < tiny) { c = tiny; }
+		d = 1 / d;
+		double delta = d * c;
+		h *= delta;
+		if (std::fabs(delta - 1) < 1e-15) { break; }
+	}
+	return prefix * h;
+}
+
+
+// ----------
+// Test Suite
+// ----------
+
+TestResult frequencyTest(const Source& source, size_t count) {
+	Reader reader(source);
+	std::vector<uint64_t> observed(4 * 256, 0);
+	for (size_t i = 0; i < count; i++) {
+		uint32_t x = reader.next();
+		for (int byte = 0; byte < 4; byte++) { observed[byte * 256 + ((x >> (8 * byte)) & 0xFF)]++; }
+	}
+
+	std::vector<double> expected(observed.size(), count / 256.0);
+	return result(chiSquare(observed, expected), 4 * 255);
+}
+
+// Pairs don't overlap, so the counts are independent and the plain chi-square applies
+TestResult serialTest(const Source& source, size_t count) {
+	Reader reader(source);
+	std::vector<uint64_t> observed(2 * 65536, 0);
+	size_t pairs = count / 2;
+	for (size_t i = 0; i < pairs; i++) {
+		uint32_t first = reader.next();
+		uint32_t second = reader.next();
+		observed[((first >> 24) << 8) | (second >> 24)]++;
+		observed[65536 + ((first & 0xFF) << 8) + (second & 0xFF)]++;
+	}
+
+	std::vector<double> expected(observed.size(), pairs / 65536.0);
+	return result(chiSquare(observed, expected), 2 * 65535);
+}
+
+// A gap of length r has probability p * (1 - p)^r, all the gaps of at least 'longest'
+// are counted together, so that each category is expected to have enough of them
+TestResult gapTest(const Source& source, size_t count) {
+	const int longest = 40;
+	const double p = 1.0 / 8;
+	Reader reader(source);
+	std::vector<uint64_t> observed(longest + 1, 0);
+	uint64_t gaps = 0;
+	int gap = 0;
+	for (size_t i = 0; i < count; i++) {
+		if ((reader.next() >> 29) == 0) {
+			observed[std::min(gap, longest)]++;
+			gaps++;
+			gap = 0;
+		}
+		else {
+			gap++;
+		}
+	}
+
+	std::vector<double> expected(longest + 1);
+	for (int r = 0; r < longest; r++) { expected[r] = gaps * p * std::pow(1 - p, r); }
+	expected[longest] = gaps * std::pow(1 - p, longest);
+	return result(chiSquare(observed, expected), longest);
+}
+
+// The mean is n^3 / (4 * days) = 2; 7 and more repeats are counted together
+TestResult birthdaySpacingsTest(const Source& source, int samples) {
+	const int birthdays = 512;
+	const int most = 7;
+	Reader reader(source);
+	std::vector<uint64_t> observed(2 * (most + 1), 0);
+	std::vector<uint32_t> days(birthdays);
+	std::vector<uint32_t> spacings(birthdays);
+
+	for (int sample = 0; sample < 2 * samples; sample++) {
+		bool high = sample % 2 == 0;
+		for (int i = 0; i < birthdays; i++) {
+			uint32_t x = reader.next();
+			days[i] = high ? x >> 8 : x & 0xFFFFFF;
+		}
+		std::sort(days.begin(), days.end());
+		spacings[0] = days[0];
+		for (int i = 1; i < birthdays; i++) { spacings[i] = days[i] - days[i - 1]; }
+		std::sort(spacings.begin(), spacings.end());
+
+		int repeats = 0;
+		for (int i = 1; i < birthdays; i++) { repeats += spacings[i] == spacings[i - 1]; }
+		observed[(high ? 0 : most + 1) + std::min(repeats, most)]++;
+	}
+
+	std::vector<double> expected(observed.size());
+	double probability = std::exp(-2.0);
+	double tail = 1.0;
+	for (int k = 0; k < most; k++) {
+		expected[k] = expected[most + 1 + k] = samples * probability;
+		tail -= probability;
+		probability *= 2.0 / (k + 1);
+	}
+	expected[most] = expected[2 * most + 1] = samples * tail;
+	return result(chiSquare(observed, expected), 2 * most);
+}
+
+
+// ----------
+// Throughput
+// ----------
+
+Throughput measureThroughput(const Source& source, size_t count, int wordBytes) {
+	std::vector<uint32_t> block(1 << 14);
+	uint32_t checksum = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	uint64_t startCycles = cycles();
+	for (size_t done = 0; done < count; done += block.size()) {
+		size_t size = std::min(block.size(), count - done);
+		source(block.data(), size);
+		checksum ^= block[size - 1];
+	}
+	uint64_t endCycles = cycles();
+	auto end = std::chrono::steady_clock::now();
+	sink = checksum;
+
+	double seconds = std::chrono::duration<double>(end - start).count();
+	double bytes = 4.0 * count;
+	double numbers = bytes / wordBytes;
+	return { bytes / seconds / 1e9, hasCycleCounter ? (endCycles - startCycles) / numbers : -1.0 };
+}
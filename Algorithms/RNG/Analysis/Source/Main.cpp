@@ -0,0 +1,266 @@
+// Title:   Analysis Algorithm
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include "Analysis.h"
+#include "MiddleSquareMethod.h"
+#include "LCG.h"
+#include "Xorshift32.h"
+#include "MersenneTwister.h"
+#include "MersenneTwister64.h"
+#include "PCG.h"
+#include "Xoshiro.h"
+#include "CounterBased.h"
+
+#if defined(_WIN32)
+#include <io.h>
+#include <fcntl.h>
+#define popen _popen
+#define pclose _pclose
+#else
+#include <csignal>
+#endif
+
+#if defined(TESTU01)
+extern "C" {
+#include "unif01.h"
+#include "bbattery.h"
+}
+#endif
+
+
+struct Engine {
+	std::string name;
+	int wordBytes;     // Size of one number of the generator
+	Source source;
+};
+
+
+// ---------------
+// Engine Adapters
+// ---------------
+
+// Generator, which returns one 32-bit number at a time
+template <typename Generator>
+Source words32(const Generator& generator) {
+	return [engine = generator](uint32_t* out, size_t count) mutable {
+		for (size_t i = 0; i < count; i++) { out[i] = static_cast<uint32_t>(engine.generate()); }
+	};
+}
+
+// Generator with fill() of 32-bit numbers
+template <typename Generator>
+Source bulk32(const Generator& generator) {
+	return [engine = generator](uint32_t* out, size_t count) mutable { engine.fill(out, count); };
+}
+
+// Generator, which returns one 64-bit number at a time, split into the low and the high half
+template <typename Generator>
+Source words64(const Generator& generator) {
+	return [engine = generator](uint32_t* out, size_t count) mutable {
+		for (size_t i = 0; i < count; i += 2) {
+			uint64_t x = engine.generate();
+			out[i] = static_cast<uint32_t>(x);
+			if (i + 1 < count) { out[i + 1] = static_cast<uint32_t>(x >> 32); }
+		}
+	};
+}
+
+// Generator with fill() of 64-bit numbers, which are split the same way
+template <typename Generator>
+Source bulk64(const Generator& generator) {
+	return [engine = generator](uint32_t* out, size_t count) mutable {
+		uint64_t block[512];
+		for (size_t done = 0; done < count;) {
+			size_t size = std::min<size_t>(512, (count - done + 1) / 2);
+			engine.fill(block, size);
+			for (size_t j = 0; j < size && done < count; j++) {
+				out[done++] = static_cast<uint32_t>(block[j]);
+				if (done < count) { out[done++] = static_cast<uint32_t>(block[j] >> 32); }
+			}
+		}
+	};
+}
+
+// Every generator of this folder with the same seed, where possible
+std::vector<Engine> createEngines() {
+	std::vector<Engine> engines;
+
+	// Numbers of 4 digits are scaled to the whole range of 32 bits, to be judged fairly
+	engines.push_back({ "Middle-Square Method", 4, [](uint32_t* out, size_t count) {
+		for (size_t i = 0; i < count; i++) { out[i] = static_cast<uint32_t>((middleSquareMethod() << 32) / 10000); }
+	} });
+	engines.push_back({ "LCG", 4, words32(LCG(12345)) });
+	engines.push_back({ "Xorshift32", 4, words32(Xorshift32(12345)) });
+	engines.push_back({ "Mersenne Twister", 4, bulk32(MersenneTwister(12345)) });
+	engines.push_back({ "MT19937-64", 8, bulk64(MersenneTwister64(12345)) });
+	engines.push_back({ "PCG32", 4, words32(PCG32(12345)) });
+	engines.push_back({ "PCG32 (8 lanes)", 4, bulk32(PCG32X8(12345)) });
+	engines.push_back({ "PCG64", 8, words64(PCG64({ 0, 12345 })) });
+	engines.push_back({ "Xoshiro128+", 4, words32(Xoshiro128Plus(12345)) });
+	engines.push_back({ "Xoshiro128+ (8 lanes)", 4, bulk32(Xoshiro128PlusX8(12345)) });
+	engines.push_back({ "Xoshiro256**", 8, words64(Xoshiro256StarStar(12345)) });
+	engines.push_back({ "Xoshiro256** (4 lanes)", 8, bulk64(Xoshiro256StarStarX4(12345)) });
+	engines.push_back({ "Philox4x32-10", 4, bulk32(Philox4x32(12345)) });
+	engines.push_back({ "Threefry4x64-20", 8, bulk64(Threefry4x64(12345)) });
+	return engines;
+}
+
+
+// ------------------
+// External Batteries
+// ------------------
+
+// Writes 'bytes' of raw output (endless if 0) until the reader stops accepting it
+void writeRaw(const Source& source, FILE* out, unsigned long long bytes) {
+	std::vector<uint32_t> block(1 << 14);
+	for (unsigned long long written = 0; bytes == 0 || written < bytes; written += 4 * block.size()) {
+		source(block.data(), block.size());
+		if (std::fwrite(block.data(), 4, block.size(), out) != block.size()) { return; }
+	}
+}
+
+// PractRand's RNG_test reads numbers from the standard input, so it has to be on the PATH
+bool hasPractRand() {
+#if defined(_WIN32)
+	return std::system("where RNG_test >nul 2>&1") == 0;
+#else
+	return std::system("command -v RNG_test >/dev/null 2>&1") == 0;
+#endif
+}
+
+void runPractRand(const Source& source) {
+#if !defined(_WIN32)
+	std::signal(SIGPIPE, SIG_IGN);   // RNG_test may exit before reading everything
+#endif
+	FILE* pipe = popen("RNG_test stdin32 -tlmax 1GB", "w");
+	if (pipe == nullptr) {
+		std::cout << "Couldn't start RNG_test.\n";
+		return;
+	}
+	writeRaw(source, pipe, 1ull << 30);
+	pclose(pipe);
+}
+
+#if defined(TESTU01)
+// TestU01 takes a plain function as a generator, so the source is reached through globals
+static const Source* testedSource = nullptr;
+static std::vector<uint32_t> testedBlock(1 << 14);
+static size_t testedPosition = 1 << 14;
+
+static unsigned int nextTested() {
+	if (testedPosition == testedBlock.size()) {
+		(*testedSource)(testedBlock.data(), testedBlock.size());
+		testedPosition = 0;
+	}
+	return testedBlock[testedPosition++];
+}
+
+void runSmallCrush(const Engine& engine) {
+	testedSource = &engine.source;
+	testedPosition = testedBlock.size();
+	std::vector<char> name(engine.name.begin(), engine.name.end());
+	name.push_back('\0');
+	unif01_Gen* generator = unif01_CreateExternGenBits(name.data(), nextTested);
+	bbattery_SmallCrush(generator);
+	unif01_DeleteExternGenBits(generator);
+}
+#endif
+
+
+// -----
+// Table
+// -----
+
+void printPValue(const TestResult& result) {
+	std::cout << std::setw(11) << std::fixed << std::setprecision(4) << result.pValue << (passed(result) ? " " : "*");
+}
+
+// Runs the battery on every generator, 'millions' sets the number of words of each test
+void runBattery(std::vector<Engine>& engines, int millions) {
+	size_t count = static_cast<size_t>(millions) << 20;
+	std::cout << std::left << std::setw(28) << "Generator" << std::right << std::setw(12) << "Frequency"
+		<< std::setw(12) << "Serial" << std::setw(12) << "Gap" << std::setw(12) << "Birthday"
+		<< std::setw(8) << "GB/s" << std::setw(12) << "Cycles/num" << std::setw(9) << "Verdict" << std::endl;
+
+	for (size_t i = 0; i < engines.size(); i++) {
+		Engine& engine = engines[i];
+		Throughput speed = measureThroughput(engine.source, count, engine.wordBytes);
+		TestResult results[] = {
+			frequencyTest(engine.source, count),
+			serialTest(engine.source, count),
+			gapTest(engine.source, count),
+			birthdaySpacingsTest(engine.source, 250 * millions)
+		};
+
+		int failures = 0;
+		std::cout << std::setw(2) << i + 1 << ". " << std::left << std::setw(24) << engine.name << std::right;
+		for (const TestResult& result : results) {
+			printPValue(result);
+			failures += !passed(result);
+		}
+		std::cout << std::setw(8) << std::setprecision(2) << speed.gigabytesPerSecond;
+		if (speed.cyclesPerNumber < 0) { std::cout << std::setw(12) << "-"; }
+		else { std::cout << std::setw(12) << std::setprecision(2) << speed.cyclesPerNumber; }
+		std::cout << std::setw(9) << (failures == 0 ? "PASS" : "FAIL") << std::endl;
+	}
+	std::cout << std::defaultfloat << std::setprecision(6) << "* p-value outside [" << significance << ", " << 1 - significance << "]\n\n";
+}
+
+int main(int argc, char* argv[]) {
+	std::vector<Engine> engines = createEngines();
+
+	// Raw output for external batteries, e.g. "Analysis --stdout 4 | RNG_test stdin32"
+	if (argc == 3 && std::string(argv[1]) == "--stdout") {
+		int index = std::atoi(argv[2]);
+		if (index < 1 || index > static_cast<int>(engines.size())) { return 1; }
+#if defined(_WIN32)
+		_setmode(_fileno(stdout), _O_BINARY);
+#endif
+		writeRaw(engines[index - 1].source, stdout, 0);
+		return 0;
+	}
+
+	// Greet
+	std::cout << "\tWelcome to the 'Analysis' console application!\n\n";
+
+	// Prompt the user for input
+	std::cout << "Enter the size of each test in millions of numbers (16 is recommended): ";
+	int millions = 0;
+	std::cin >> millions;
+	if (millions < 1) { millions = 1; }
+
+	// Test every generator
+	std::cout << "\nRunning the battery:\n";
+	runBattery(engines, millions);
+
+	// Hand a generator over to the external batteries, if they are available
+	if (hasPractRand()) {
+		std::cout << "Pipe a generator to PractRand? (1 - " << engines.size() << ", 0 - no): ";
+		int index = 0;
+		std::cin >> index;
+		if (index >= 1 && index <= static_cast<int>(engines.size())) { runPractRand(engines[index - 1].source); }
+	}
+#if defined(TESTU01)
+	std::cout << "Run SmallCrush of TestU01 on a generator? (1 - " << engines.size() << ", 0 - no): ";
+	int index = 0;
+	std::cin >> index;
+	if (index >= 1 && index <= static_cast<int>(engines.size())) { runSmallCrush(engines[index - 1]); }
+#endif
+
+	// Exit
+	std::cout << "\nThanks for using this program! Have a great day!\n";
+	std::cout << "Press <Enter> to exit...";
+	std::cin.ignore();
+	std::cin.get();
+	return 0;
+}
@@ -0,0 +1,63 @@
+// Title:   Header file for Counter-Based Generators
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef COUNTER_BASED_H
+#define COUNTER_BASED_H
+
+
+#include <cstdint>
+#include <cstddef>
+
+
+// Both generators have no state to advance: a block of numbers is a pure function of the key
+// (seed) and the counter (index of the block and stream), so the i-th number of any stream
+// is computed directly, and any number of threads can share a generator without locks.
+// The position and the last computed block only serve the sequential generate()
+
+
+// Philox4x32-10: 128-bit counter, 64-bit key, 10 rounds of two 32-bit multiplications
+class Philox4x32 {
+private:
+	uint32_t key[2];
+	uint64_t stream;                  // High half of the counter
+	uint64_t position = 0;            // Index of the next number of generate()
+	uint64_t bufferedBlock = ~0ull;   // Index of the block in the buffer, none at first
+	uint32_t buffer[4];
+
+public:
+	Philox4x32(uint64_t seed, uint64_t streamIndex = 0);
+	static void block(const uint32_t key[2], const uint32_t counter[4], uint32_t out[4]);
+
+	uint32_t at(uint64_t index) const;        // Number 'index' of the stream, position is unchanged
+	void fill(uint64_t index, uint32_t* out, size_t count) const;   // Numbers from 'index' onwards
+	uint32_t generate();
+	void fill(uint32_t* out, size_t count);   // Continues from the position, as generate() does
+	void seek(uint64_t index);
+};
+
+
+// Threefry4x64-20: 256-bit counter and key, 20 rounds of additions, rotations and xors
+class Threefry4x64 {
+private:
+	uint64_t key[4];
+	uint64_t stream;
+	uint64_t position = 0;
+	uint64_t bufferedBlock = ~0ull;
+	uint64_t buffer[4];
+
+public:
+	Threefry4x64(uint64_t seed, uint64_t streamIndex = 0);
+	static void block(const uint64_t key[4], const uint64_t counter[4], uint64_t out[4]);
+
+	uint64_t at(uint64_t index) const;
+	void fill(uint64_t index, uint64_t* out, size_t count) const;
+	uint64_t generate();
+	void fill(uint64_t* out, size_t count);
+	void seek(uint64_t index);
+};
+
+
+#endif // COUNTER_BASED_H
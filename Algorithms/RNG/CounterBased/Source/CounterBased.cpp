@@ -0,0 +1,303 @@
+// Title:   Source file for Counter-Based Generators
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "CounterBased.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+// ----------
+// Philox4x32
+// ----------
+
+static const uint32_t philoxMultiplier0 = 0xD2511F53u;
+static const uint32_t philoxMultiplier1 = 0xCD9E8D57u;
+static const uint32_t philoxWeyl0 = 0x9E3779B9u;   // Golden ratio
+static const uint32_t philoxWeyl1 = 0xBB67AE85u;   // sqrt(3) - 1
+
+// Blocks are numbered within the stream, which takes the other half of the counter
+static void philoxCounter(uint64_t blockIndex, uint64_t stream, uint32_t counter[4]) {
+	counter[0] = static_cast<uint32_t>(blockIndex);
+	counter[1] = static_cast<uint32_t>(blockIndex >> 32);
+	counter[2] = static_cast<uint32_t>(stream);
+	counter[3] = static_cast<uint32_t>(stream >> 32);
+}
+
+Philox4x32::Philox4x32(uint64_t seed, uint64_t streamIndex) : stream(streamIndex) {
+	key[0] = static_cast<uint32_t>(seed);
+	key[1] = static_cast<uint32_t>(seed >> 32);
+}
+
+// Each round multiplies two words into 64-bit products, mixes their high halves with the other
+// two words and the key, and swaps the words around; the key is bumped by Weyl constants
+void Philox4x32::block(const uint32_t key[2], const uint32_t counter[4], uint32_t out[4]) {
+	uint32_t x[4] = { counter[0], counter[1], counter[2], counter[3] };
+	uint32_t k0 = key[0];
+	uint32_t k1 = key[1];
+	for (int round = 0; round < 10; round++) {
+		uint64_t product0 = static_cast<uint64_t>(philoxMultiplier0) * x[0];
+		uint64_t product1 = static_cast<uint64_t>(philoxMultiplier1) * x[2];
+		uint32_t y0 = static_cast<uint32_t>(product1 >> 32) ^ x[1] ^ k0;
+		uint32_t y1 = static_cast<uint32_t>(product1);
+		uint32_t y2 = static_cast<uint32_t>(product0 >> 32) ^ x[3] ^ k1;
+		uint32_t y3 = static_cast<uint32_t>(product0);
+		x[0] = y0;
+		x[1] = y1;
+		x[2] = y2;
+		x[3] = y3;
+		k0 += philoxWeyl0;
+		k1 += philoxWeyl1;
+	}
+	for (int i = 0; i < 4; i++) { out[i] = x[i]; }
+}
+
+#if defined(__AVX2__)
+// Low and high halves of the products of eight 32-bit lanes by the same multiplier:
+// even and odd lanes are multiplied separately into 64-bit products and merged back
+static void multiply8(__m256i x, __m256i multiplier, __m256i& low, __m256i& high) {
+	__m256i even = _mm256_mul_epu32(x, multiplier);
+	__m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), multiplier);
+	low = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+	high = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+}
+
+// Eight consecutive blocks at once, word j of block i is in lane i of x[j]; the result is
+// transposed back, so blocks are written one after another, exactly as the scalar version does
+static void philoxBlocks8(const uint32_t key[2], uint64_t stream, uint64_t firstBlock, uint32_t* out) {
+	alignas(32) uint32_t low[8];
+	alignas(32) uint32_t high[8];
+	for (int lane = 0; lane < 8; lane++) {
+		low[lane] = static_cast<uint32_t>(firstBlock + lane);
+		high[lane] = static_cast<uint32_t>((firstBlock + lane) >> 32);
+	}
+	__m256i x0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(low));
+	__m256i x1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(high));
+	__m256i x2 = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(stream)));
+	__m256i x3 = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(stream >> 32)));
+	const __m256i m0 = _mm256_set1_epi32(static_cast<int>(philoxMultiplier0));
+	const __m256i m1 = _mm256_set1_epi32(static_cast<int>(philoxMultiplier1));
+	uint32_t k0 = key[0];
+	uint32_t k1 = key[1];
+
+	for (int round = 0; round < 10; round++) {
+		__m256i low0, high0, low1, high1;
+		multiply8(x0, m0, low0, high0);
+		multiply8(x2, m1, low1, high1);
+		x0 = _mm256_xor_si256(_mm256_xor_si256(high1, x1), _mm256_set1_epi32(static_cast<int>(k0)));
+		x1 = low1;
+		x2 = _mm256_xor_si256(_mm256_xor_si256(high0, x3), _mm256_set1_epi32(static_cast<int>(k1)));
+		x3 = low0;
+		k0 += philoxWeyl0;
+		k1 += philoxWeyl1;
+	}
+
+	__m256i t0 = _mm256_unpacklo_epi32(x0, x1);   // Blocks 0, 1 | 4, 5 of words 0 and 1
+	__m256i t1 = _mm256_unpackhi_epi32(x0, x1);   // Blocks 2, 3 | 6, 7 of words 0 and 1
+	__m256i t2 = _mm256_unpacklo_epi32(x2, x3);
+	__m256i t3 = _mm256_unpackhi_epi32(x2, x3);
+	__m256i b04 = _mm256_unpacklo_epi64(t0, t2);
+	__m256i b15 = _mm256_unpackhi_epi64(t0, t2);
+	__m256i b26 = _mm256_unpacklo_epi64(t1, t3);
+	__m256i b37 = _mm256_unpackhi_epi64(t1, t3);
+	__m256i* target = reinterpret_cast<__m256i*>(out);
+	_mm256_storeu_si256(target + 0, _mm256_permute2x128_si256(b04, b15, 0x20));
+	_mm256_storeu_si256(target + 1, _mm256_permute2x128_si256(b26, b37, 0x20));
+	_mm256_storeu_si256(target + 2, _mm256_permute2x128_si256(b04, b15, 0x31));
+	_mm256_storeu_si256(target + 3, _mm256_permute2x128_si256(b26, b37, 0x31));
+}
+#endif
+
+uint32_t Philox4x32::at(uint64_t index) const {
+	uint32_t counter[4];
+	uint32_t out[4];
+	philoxCounter(index / 4, stream, counter);
+	block(key, counter, out);
+	return out[index % 4];
+}
+
+// The partial blocks at both ends are computed separately, the whole ones in between
+// are independent of each other, so with AVX2 eight of them are computed at once
+void Philox4x32::fill(uint64_t index, uint32_t* out, size_t count) const {
+	uint32_t counter[4];
+	uint32_t words[4];
+	size_t i = 0;
+	for (; i < count && (index + i) % 4 != 0; i++) { out[i] = at(index + i); }
+
+#if defined(__AVX2__)
+	for (; i + 32 <= count; i += 32) { philoxBlocks8(key, stream, (index + i) / 4, out + i); }
+#endif
+	for (; i + 4 <= count; i += 4) {
+		philoxCounter((index + i) / 4, stream, counter);
+		block(key, counter, out + i);
+	}
+
+	if (i < count) {
+		philoxCounter((index + i) / 4, stream, counter);
+		block(key, counter, words);
+		for (int j = 0; i < count; i++, j++) { out[i] = words[j]; }
+	}
+}
+
+// Computes a block once per four numbers
+uint32_t Philox4x32::generate() {
+	uint64_t blockIndex = position / 4;
+	if (blockIndex != bufferedBlock) {
+		uint32_t counter[4];
+		philoxCounter(blockIndex, stream, counter);
+		block(key, counter, buffer);
+		bufferedBlock = blockIndex;
+	}
+	return buffer[position++ % 4];
+}
+
+void Philox4x32::fill(uint32_t* out, size_t count) {
+	fill(position, out, count);
+	position += count;
+}
+
+void Philox4x32::seek(uint64_t index) { position = index; }
+
+
+// ------------
+// Threefry4x64
+// ------------
+
+static const uint64_t threefryParity = 0x1BD11BDAA9FC1A22ull;   // Key schedule constant of Skein
+
+// Rotations of the two mixed pairs, repeated every 8 rounds
+static const int threefryRotations[8][2] = {
+	{ 14, 16 }, { 52, 57 }, { 23, 40 }, { 5, 37 }, { 25, 33 }, { 46, 12 }, { 58, 22 }, { 32, 32 }
+};
+
+static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+static void threefryCounter(uint64_t blockIndex, uint64_t stream, uint64_t counter[4]) {
+	counter[0] = blockIndex;
+	counter[1] = stream;
+	counter[2] = 0;
+	counter[3] = 0;
+}
+
+Threefry4x64::Threefry4x64(uint64_t seed, uint64_t streamIndex) : key{ seed, 0, 0, 0 }, stream(streamIndex) {}
+
+// Each round adds one word to another, rotates the second and xors it with the sum, pairing
+// the words differently in even and odd rounds; every 4 rounds a subkey is added to all words
+void Threefry4x64::block(const uint64_t key[4], const uint64_t counter[4], uint64_t out[4]) {
+	uint64_t schedule[5] = { key[0], key[1], key[2], key[3], threefryParity ^ key[0] ^ key[1] ^ key[2] ^ key[3] };
+	uint64_t x[4];
+	for (int i = 0; i < 4; i++) { x[i] = counter[i] + schedule[i]; }
+
+	for (int round = 0; round < 20; round++) {
+		const int* r = threefryRotations[round % 8];
+		if (round % 2 == 0) {
+			x[0] += x[1]; x[1] = rotl(x[1], r[0]); x[1] ^= x[0];
+			x[2] += x[3]; x[3] = rotl(x[3], r[1]); x[3] ^= x[2];
+		}
+		else {
+			x[0] += x[3]; x[3] = rotl(x[3], r[0]); x[3] ^= x[0];
+			x[2] += x[1]; x[1] = rotl(x[1], r[1]); x[1] ^= x[2];
+		}
+		if (round % 4 == 3) {
+			int s = (round + 1) / 4;
+			for (int i = 0; i < 4; i++) { x[i] += schedule[(s + i) % 5]; }
+			x[3] += s;
+		}
+	}
+	for (int i = 0; i < 4; i++) { out[i] = x[i]; }
+}
+
+#if defined(__AVX2__)
+static __m256i rotl4(__m256i x, int k) {
+	return _mm256_or_si256(_mm256_sll_epi64(x, _mm_cvtsi32_si128(k)), _mm256_srl_epi64(x, _mm_cvtsi32_si128(64 - k)));
+}
+
+// Four consecutive blocks at once, word j of block i is in lane i of x[j]
+static void threefryBlocks4(const uint64_t key[4], uint64_t stream, uint64_t firstBlock, uint64_t* out) {
+	uint64_t schedule[5] = { key[0], key[1], key[2], key[3], threefryParity ^ key[0] ^ key[1] ^ key[2] ^ key[3] };
+	__m256i x0 = _mm256_add_epi64(_mm256_set_epi64x(3, 2, 1, 0), _mm256_set1_epi64x(static_cast<long long>(firstBlock + schedule[0])));
+	__m256i x1 = _mm256_set1_epi64x(static_cast<long long>(stream + schedule[1]));
+	__m256i x2 = _mm256_set1_epi64x(static_cast<long long>(schedule[2]));
+	__m256i x3 = _mm256_set1_epi64x(static_cast<long long>(schedule[3]));
+
+	for (int round = 0; round < 20; round++) {
+		const int* r = threefryRotations[round % 8];
+		if (round % 2 == 0) {
+			x0 = _mm256_add_epi64(x0, x1); x1 = _mm256_xor_si256(rotl4(x1, r[0]), x0);
+			x2 = _mm256_add_epi64(x2, x3); x3 = _mm256_xor_si256(rotl4(x3, r[1]), x2);
+		}
+		else {
+			x0 = _mm256_add_epi64(x0, x3); x3 = _mm256_xor_si256(rotl4(x3, r[0]), x0);
+			x2 = _mm256_add_epi64(x2, x1); x1 = _mm256_xor_si256(rotl4(x1, r[1]), x2);
+		}
+		if (round % 4 == 3) {
+			int s = (round + 1) / 4;
+			x0 = _mm256_add_epi64(x0, _mm256_set1_epi64x(static_cast<long long>(schedule[s % 5])));
+			x1 = _mm256_add_epi64(x1, _mm256_set1_epi64x(static_cast<long long>(schedule[(s + 1) % 5])));
+			x2 = _mm256_add_epi64(x2, _mm256_set1_epi64x(static_cast<long long>(schedule[(s + 2) % 5])));
+			x3 = _mm256_add_epi64(x3, _mm256_set1_epi64x(static_cast<long long>(schedule[(s + 3) % 5] + s)));
+		}
+	}
+
+	__m256i t0 = _mm256_unpacklo_epi64(x0, x1);   // Blocks 0 | 2 of words 0 and 1
+	__m256i t1 = _mm256_unpackhi_epi64(x0, x1);   // Blocks 1 | 3 of words 0 and 1
+	__m256i t2 = _mm256_unpacklo_epi64(x2, x3);
+	__m256i t3 = _mm256_unpackhi_epi64(x2, x3);
+	__m256i* target = reinterpret_cast<__m256i*>(out);
+	_mm256_storeu_si256(target + 0, _mm256_permute2x128_si256(t0, t2, 0x20));
+	_mm256_storeu_si256(target + 1, _mm256_permute2x128_si256(t1, t3, 0x20));
+	_mm256_storeu_si256(target + 2, _mm256_permute2x128_si256(t0, t2, 0x31));
+	_mm256_storeu_si256(target + 3, _mm256_permute2x128_si256(t1, t3, 0x31));
+}
+#endif
+
+uint64_t Threefry4x64::at(uint64_t index) const {
+	uint64_t counter[4];
+	uint64_t out[4];
+	threefryCounter(index / 4, stream, counter);
+	block(key, counter, out);
+	return out[index % 4];
+}
+
+void Threefry4x64::fill(uint64_t index, uint64_t* out, size_t count) const {
+	uint64_t counter[4];
+	uint64_t words[4];
+	size_t i = 0;
+	for (; i < count && (index + i) % 4 != 0; i++) { out[i] = at(index + i); }
+
+#if defined(__AVX2__)
+	for (; i + 16 <= count; i += 16) { threefryBlocks4(key, stream, (index + i) / 4, out + i); }
+#endif
+	for (; i + 4 <= count; i += 4) {
+		threefryCounter((index + i) / 4, stream, counter);
+		block(key, counter, out + i);
+	}
+
+	if (i < count) {
+		threefryCounter((index + i) / 4, stream, counter);
+		block(key, counter, words);
+		for (int j = 0; i < count; i++, j++) { out[i] = words[j]; }
+	}
+}
+
+uint64_t Threefry4x64::generate() {
+	uint64_t blockIndex = position / 4;
+	if (blockIndex != bufferedBlock) {
+		uint64_t counter[4];
+		threefryCounter(blockIndex, stream, counter);
+		block(key, counter, buffer);
+		bufferedBlock = blockIndex;
+	}
+	return buffer[position++ % 4];
+}
+
+void Threefry4x64::fill(uint64_t* out, size_t count) {
+	fill(position, out, count);
+	position += count;
+}
+
+void Threefry4x64::seek(uint64_t index) { position = index; }
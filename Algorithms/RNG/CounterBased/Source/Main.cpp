@@ -0,0 +1,132 @@
+// Title:   Counter-Based Generators Algorithm
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <thread>
+#include <chrono>
+#include "CounterBased.h"
+
+
+// Estimates Pi with 'points' random points, where point i always takes numbers 2i and 2i + 1
+// of the stream, no matter which thread handles it, so the result doesn't depend on 'threadsCount'
+double estimatePi(const Philox4x32& generator, uint64_t points, int threadsCount) {
+	std::vector<uint64_t> inside(threadsCount, 0);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < threadsCount; t++) {
+		threads.emplace_back([&, t]() {
+			uint64_t begin = points * t / threadsCount;
+			uint64_t end = points * (t + 1) / threadsCount;
+			for (uint64_t i = begin; i < end; i++) {
+				double x = generator.at(2 * i) / 4294967296.0;
+				double y = generator.at(2 * i + 1) / 4294967296.0;
+				inside[t] += x * x + y * y < 1.0;
+			}
+		});
+	}
+	for (std::thread& thread : threads) { thread.join(); }
+
+	uint64_t total = 0;
+	for (uint64_t count : inside) { total += count; }
+	return 4.0 * total / points;
+}
+
+// Measures time of generating 'count' numbers of the given type with 'generate',
+// which writes them into the buffer; the checksum prevents the work from being optimized out
+template <typename Word, typename Generate>
+void measure(const std::string& name, size_t count, Generate generate) {
+	std::vector<Word> buffer(count);
+	auto start = std::chrono::steady_clock::now();
+	generate(buffer.data(), count);
+	auto end = std::chrono::steady_clock::now();
+
+	Word checksum = 0;
+	for (Word x : buffer) { checksum ^= x; }
+	double seconds = std::chrono::duration<double>(end - start).count();
+	std::cout << std::setw(24) << name << std::fixed << std::setprecision(1)
+		<< std::setw(16) << count / seconds / 1e6 << std::setw(10) << count * sizeof(Word) / seconds / 1e9
+		<< "   (checksum " << std::hex << static_cast<unsigned long long>(checksum) << std::dec << ")" << std::endl;
+}
+
+// Compares one number at a time with the bulk generation
+void benchmark() {
+	const size_t count = 1 << 24;
+	std::cout << std::setw(24) << "Generator" << std::setw(16) << "Numbers/s (M)" << std::setw(10) << "GB/s" << std::endl;
+	measure<uint32_t>("Philox4x32 generate()", count, [](uint32_t* out, size_t size) {
+		Philox4x32 generator(1234);
+		for (size_t i = 0; i < size; i++) { out[i] = generator.generate(); }
+	});
+	measure<uint32_t>("Philox4x32 fill()", count, [](uint32_t* out, size_t size) {
+		Philox4x32 generator(1234);
+		generator.fill(out, size);
+	});
+	measure<uint64_t>("Threefry4x64 generate()", count, [](uint64_t* out, size_t size) {
+		Threefry4x64 generator(1234);
+		for (size_t i = 0; i < size; i++) { out[i] = generator.generate(); }
+	});
+	measure<uint64_t>("Threefry4x64 fill()", count, [](uint64_t* out, size_t size) {
+		Threefry4x64 generator(1234);
+		generator.fill(out, size);
+	});
+}
+
+int main() {
+	// Greet
+	std::cout << "\tWelcome to the 'Counter-Based Generators' console application!\n\n";
+
+	// Prompt the user for input
+	std::cout << "Enter the number of random numbers: ";
+	int n = 0;
+	std::cin >> n;
+	std::cout << "Enter the minimum value:\t    ";
+	int minVal = 0;
+	std::cin >> minVal;
+	std::cout << "Enter the maximum value:\t    ";
+	int maxVal = 0;
+	std::cin >> maxVal;
+
+	// Generate random numbers within the user-defined range
+	Philox4x32 prng(1234);
+	std::cout << "\nGenerating " << n << " random numbers between " << minVal << " and " << maxVal << ":\n";
+	for (int i = 0; i < n; ++i) {
+		uint32_t randomNumber = minVal + (prng.generate() % (maxVal - minVal + 1));
+		std::cout << " " << i + 1 << ":\t" << randomNumber << std::endl;
+	}
+	std::cout << std::endl;
+
+	// Access any number directly, without generating the ones before it
+	std::cout << "Number 1000000 of the stream computed directly:  " << prng.at(1000000) << std::endl;
+	std::vector<uint32_t> numbers(1000001);
+	Philox4x32 sequential(1234);
+	sequential.fill(numbers.data(), numbers.size());
+	std::cout << "Number 1000000 after generating all before it:   " << numbers[1000000] << std::endl;
+	std::cout << "First numbers of Threefry4x64 streams 0, 1, 2:   ";
+	for (uint64_t stream = 0; stream < 3; stream++) { std::cout << Threefry4x64(1234, stream).at(0) << " "; }
+	std::cout << "\n\n";
+
+	// The same result with any number of threads
+	std::cout << "Estimating Pi with 10^7 points:\n";
+	for (int threadsCount : { 1, 2, 4, 8 }) {
+		std::cout << " " << threadsCount << " thread(s):\t" << std::setprecision(10)
+			<< estimatePi(prng, 10000000, threadsCount) << std::endl;
+	}
+	std::cout << std::endl;
+
+	// Compare single numbers with the bulk generation
+	std::cout << "Run the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) { benchmark(); }
+
+	// Exit
+	std::cout << "\nThanks for using this program! Have a great day!\n";
+	std::cout << "Press <Enter> to exit...";
+	std::cin.ignore();
+	std::cin.get();
+	return 0;
+}
@@ -0,0 +1,232 @@
+// Title:   Header file for Distributions
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef DISTRIBUTIONS_H
+#define DISTRIBUTIONS_H
+
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+
+// Every function works with any generator, which has generate() returning either 32-bit or
+// 64-bit unsigned numbers (Xorshift32, MersenneTwister, PCG, Xoshiro and others); generators
+// that also have fill(out, count) of the same type are used in bulk by the fill functions
+
+
+// --------
+// Raw Bits
+// --------
+
+template <typename Engine>
+uint32_t bits32(Engine& engine) {
+	auto x = engine.generate();
+	return static_cast<uint32_t>(sizeof(x) > 4 ? (static_cast<uint64_t>(x) >> 32) : x);
+}
+
+template <typename Engine>
+uint64_t bits64(Engine& engine) {
+	auto x = engine.generate();
+	if (sizeof(x) > 4) { return static_cast<uint64_t>(x); }
+	return (static_cast<uint64_t>(x) << 32) | static_cast<uint32_t>(engine.generate());
+}
+
+// Bulk raw numbers: fill() of the generator if it has one, otherwise one by one
+template <typename Engine, typename Word>
+auto rawFill(Engine& engine, Word* out, size_t count, int) -> decltype(engine.fill(out, count), void()) {
+	engine.fill(out, count);
+}
+
+template <typename Engine, typename Word>
+void rawFill(Engine& engine, Word* out, size_t count, long) {
+	for (size_t i = 0; i < count; i++) { out[i] = static_cast<Word>(engine.generate()); }
+}
+
+
+// ----------------
+// Bounded Integers
+// ----------------
+
+// Uniform integer in [0, range) with Lemire's method: the high half of x * range is the result,
+// and the low half shows whether x fell into the few values that would make it biased;
+// the costly division is computed only in that rare case
+template <typename Engine>
+uint32_t uniformInt(Engine& engine, uint32_t range) {
+	uint64_t product = static_cast<uint64_t>(bits32(engine)) * range;
+	uint32_t low = static_cast<uint32_t>(product);
+	if (low < range) {
+		uint32_t threshold = (0u - range) % range;
+		while (low < threshold) {
+			product = static_cast<uint64_t>(bits32(engine)) * range;
+			low = static_cast<uint32_t>(product);
+		}
+	}
+	return static_cast<uint32_t>(product >> 32);
+}
+
+// Uniform integer in [minVal, maxVal]
+template <typename Engine>
+int uniformInt(Engine& engine, int minVal, int maxVal) {
+	uint32_t range = static_cast<uint32_t>(static_cast<int64_t>(maxVal) - minVal + 1);
+	if (range == 0) { return static_cast<int>(bits32(engine)); } // Whole range of int
+	return static_cast<int>(static_cast<int64_t>(minVal) + uniformInt(engine, range));
+}
+
+
+// --------------
+// Floating-Point
+// --------------
+
+// Highest 53 (24) bits scaled by 2^-53 (2^-24), so every result is exactly representable,
+// evenly spaced in [0, 1) and never reaches 1, while only one multiplication is needed
+inline double toDouble(uint64_t bits) { return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0); }
+inline float toFloat(uint32_t bits) { return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f); }
+
+template <typename Engine>
+double uniformDouble(Engine& engine) { return toDouble(bits64(engine)); }
+
+template <typename Engine>
+float uniformFloat(Engine& engine) { return toFloat(bits32(engine)); }
+
+
+// ----------------------
+// Normal and Exponential
+// ----------------------
+
+// Ziggurat tables: the area under the density is covered by layers of equal area, layer i
+// spans [0, x[i]] horizontally and [f[i], f[i + 1]] vertically, and its part with |x| < x[i + 1]
+// lies entirely under the curve; ratio[i] = x[i + 1] / x[i] allows testing that without multiplying
+template <int Layers>
+struct Ziggurat {
+	double x[Layers + 1];
+	double f[Layers + 1];
+	double ratio[Layers];
+	double r;   // Start of the tail
+};
+
+extern const Ziggurat<128> normalZiggurat;
+extern const Ziggurat<256> exponentialZiggurat;
+
+// Standard normal number (mean 0, deviation 1) with the ziggurat method: one random layer
+// and one random position in it, which in about 99% of cases is accepted at once
+template <typename Engine>
+double normal(Engine& engine) {
+	const Ziggurat<128>& z = normalZiggurat;
+	while (true) {
+		// Independent bits: 7 for the layer, 1 for the sign and 53 for the position
+		uint64_t bits = bits64(engine);
+		int i = static_cast<int>(bits & 127u);
+		double sign = (bits & 128u) ? -1.0 : 1.0;
+		double u = toDouble(bits);
+		if (u < z.ratio[i]) { return sign * u * z.x[i]; }
+
+		double x = u * z.x[i];
+		if (i == 0) {
+			// Tail beyond r is sampled with Marsaglia's method
+			double tail = 0;
+			double y = 0;
+			do {
+				tail = -std::log(1.0 - uniformDouble(engine)) / z.r;
+				y = -std::log(1.0 - uniformDouble(engine));
+			} while (y + y < tail * tail);
+			return sign * (z.r + tail);
+		}
+
+		// Wedge: accept if a random height in the layer is under the curve
+		if (z.f[i] + uniformDouble(engine) * (z.f[i + 1] - z.f[i]) < std::exp(-0.5 * x * x)) { return sign * x; }
+	}
+}
+
+// Normal number with the given mean and deviation
+template <typename Engine>
+double normal(Engine& engine, double mean, double deviation) { return mean + deviation * normal(engine); }
+
+// Exponential number with rate 1 with the ziggurat method
+template <typename Engine>
+double exponential(Engine& engine) {
+	const Ziggurat<256>& z = exponentialZiggurat;
+	while (true) {
+		uint64_t bits = bits64(engine);
+		int i = static_cast<int>(bits & 255u);
+		double u = toDouble(bits);
+		if (u < z.ratio[i]) { return u * z.x[i]; }
+
+		double x = u * z.x[i];
+		if (i == 0) {
+			// The tail of exponential distribution is the distribution itself, shifted by r
+			return z.r + -std::log(1.0 - uniformDouble(engine));
+		}
+
+		if (z.f[i] + uniformDouble(engine) * (z.f[i + 1] - z.f[i]) < std::exp(-x)) { return x; }
+	}
+}
+
+// Exponential number with the given rate
+template <typename Engine>
+double exponential(Engine& engine, double rate) { return exponential(engine) / rate; }
+
+
+// ----------
+// Bulk Fills
+// ----------
+
+// Raw numbers are generated in blocks with fill() of the generator, if it has one,
+// and converted afterwards, which lets both loops be simple and vectorizable
+template <typename Engine>
+void fillUniformInt(Engine& engine, uint32_t* out, size_t count, uint32_t range) {
+	typedef decltype(engine.generate()) Word;
+	const size_t block = 256;
+	Word raw[block];
+	for (size_t i = 0; i < count; i += block) {
+		size_t length = (count - i < block) ? count - i : block;
+		rawFill(engine, raw, length, 0);
+		for (size_t j = 0; j < length; j++) {
+			uint32_t x = static_cast<uint32_t>(sizeof(Word) > 4 ? (static_cast<uint64_t>(raw[j]) >> 32) : raw[j]);
+			uint64_t product = static_cast<uint64_t>(x) * range;
+			// Rare rejections are redrawn one by one
+			if (static_cast<uint32_t>(product) < range) {
+				uint32_t threshold = (0u - range) % range;
+				while (static_cast<uint32_t>(product) < threshold) { product = static_cast<uint64_t>(bits32(engine)) * range; }
+			}
+			out[i + j] = static_cast<uint32_t>(product >> 32);
+		}
+	}
+}
+
+template <typename Engine>
+void fillUniformDouble(Engine& engine, double* out, size_t count) {
+	typedef decltype(engine.generate()) Word;
+	if (sizeof(Word) > 4) {
+		const size_t block = 256;
+		Word raw[block];
+		for (size_t i = 0; i < count; i += block) {
+			size_t length = (count - i < block) ? count - i : block;
+			rawFill(engine, raw, length, 0);
+			for (size_t j = 0; j < length; j++) { out[i + j] = toDouble(static_cast<uint64_t>(raw[j])); }
+		}
+	} else {
+		for (size_t i = 0; i < count; i++) { out[i] = uniformDouble(engine); }
+	}
+}
+
+template <typename Engine>
+void fillUniformFloat(Engine& engine, float* out, size_t count) {
+	for (size_t i = 0; i < count; i++) { out[i] = uniformFloat(engine); }
+}
+
+template <typename Engine>
+void fillNormal(Engine& engine, double* out, size_t count, double mean = 0.0, double deviation = 1.0) {
+	for (size_t i = 0; i < count; i++) { out[i] = normal(engine, mean, deviation); }
+}
+
+template <typename Engine>
+void fillExponential(Engine& engine, double* out, size_t count, double rate = 1.0) {
+	for (size_t i = 0; i < count; i++) { out[i] = exponential(engine, rate); }
+}
+
+
+#endif // DISTRIBUTIONS_H
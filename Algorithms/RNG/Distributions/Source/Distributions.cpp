@@ -0,0 +1,35 @@
+// Title:   Source file for Distributions
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "Distributions.h"
+
+
+// Builds the layers from the top of the tail down: the base layer (0) is the rectangle under
+// the tail start r together with the tail itself, so its width x[0] is chosen to give it
+// the same area v as the others; each next boundary is where the rectangle of area v ends
+template <int Layers, typename Density, typename Inverse>
+static Ziggurat<Layers> buildZiggurat(double r, double v, Density f, Inverse inverse) {
+	Ziggurat<Layers> z;
+	z.r = r;
+	z.x[0] = v / f(r);
+	z.x[1] = r;
+	for (int i = 1; i < Layers - 1; i++) { z.x[i + 1] = inverse(v / z.x[i] + f(z.x[i])); }
+	z.x[Layers] = 0.0;
+
+	for (int i = 0; i <= Layers; i++) { z.f[i] = f(z.x[i]); }
+	for (int i = 0; i < Layers; i++) { z.ratio[i] = z.x[i + 1] / z.x[i]; }
+	return z;
+}
+
+// Constants r and v (area of each layer) for 128 layers of the half of normal density
+// exp(-x^2 / 2) and for 256 layers of exponential density exp(-x), as found by Marsaglia and Tsang
+const Ziggurat<128> normalZiggurat = buildZiggurat<128>(3.442619855899, 9.91256303526217e-3,
+	[](double x) { return std::exp(-0.5 * x * x); },
+	[](double y) { return std::sqrt(-2.0 * std::log(y)); });
+
+const Ziggurat<256> exponentialZiggurat = buildZiggurat<256>(7.697117470131487, 3.949659822581572e-3,
+	[](double x) { return std::exp(-x); },
+	[](double y) { return -std::log(y); });
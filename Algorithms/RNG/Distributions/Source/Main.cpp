@@ -0,0 +1,120 @@
+// Title:   Distributions Algorithm
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include "Distributions.h"
+#include "Xorshift32.h"        // From the Xorshift32 folder
+#include "MersenneTwister.h"   // From the Mersenne Twister folder
+
+
+// Measures average nanoseconds per number of 'run', which generates 'count' numbers
+// and returns their sum, so that the work can't be optimized out
+template <typename Run>
+void measure(const std::string& name, int count, Run run) {
+	auto start = std::chrono::steady_clock::now();
+	double sum = run();
+	auto end = std::chrono::steady_clock::now();
+
+	std::cout << std::setw(32) << name << std::fixed << std::setprecision(2) << std::setw(12)
+		<< std::chrono::duration<double, std::nano>(end - start).count() / count
+		<< "   (mean " << std::setprecision(4) << sum / count << ")" << std::endl;
+}
+
+// Same as above for a single number per call
+template <typename Generate>
+void measureEach(const std::string& name, int count, Generate generate) {
+	measure(name, count, [&]() {
+		double sum = 0;
+		for (int i = 0; i < count; i++) { sum += generate(); }
+		return sum;
+	});
+}
+
+// Compares the distributions with the ones of the standard library, driven by the same
+// sequence: MersenneTwister of this repository and std::mt19937 implement the same MT19937
+void benchmark() {
+	const int count = 1 << 24;
+	const uint32_t range = 1000;
+	std::mt19937 engine(42);
+	MersenneTwister twister(42);
+	std::vector<uint32_t> ints(count);
+	std::vector<double> doubles(count);
+
+	std::cout << std::setw(32) << "Method" << std::setw(12) << "ns/number" << std::endl;
+	std::uniform_int_distribution<uint32_t> uniformIntStd(0, range - 1);
+	measureEach("% range (biased)", count, [&]() { return engine() % range; });
+	measureEach("std::uniform_int_distribution", count, [&]() { return uniformIntStd(engine); });
+	measureEach("uniformInt", count, [&]() { return uniformInt(twister, range); });
+	measure("fillUniformInt", count, [&]() {
+		fillUniformInt(twister, ints.data(), count, range);
+		double sum = 0;
+		for (uint32_t x : ints) { sum += x; }
+		return sum;
+	});
+
+	std::uniform_real_distribution<double> uniformRealStd(0.0, 1.0);
+	measureEach("std::uniform_real_distribution", count, [&]() { return uniformRealStd(engine); });
+	measureEach("uniformDouble", count, [&]() { return uniformDouble(twister); });
+	std::normal_distribution<double> normalStd(0.0, 1.0);
+	measureEach("std::normal_distribution", count, [&]() { return normalStd(engine); });
+	measureEach("normal (ziggurat)", count, [&]() { return normal(twister); });
+	measure("fillNormal (ziggurat)", count, [&]() {
+		fillNormal(twister, doubles.data(), count);
+		double sum = 0;
+		for (double x : doubles) { sum += x; }
+		return sum;
+	});
+	std::exponential_distribution<double> exponentialStd(1.0);
+	measureEach("std::exponential_distribution", count, [&]() { return exponentialStd(engine); });
+	measureEach("exponential (ziggurat)", count, [&]() { return exponential(twister); });
+}
+
+int main() {
+	// Greet
+	std::cout << "\tWelcome to the 'Distributions' console application!\n\n";
+
+	// Prompt the user for input
+	std::cout << "Enter the number of random numbers: ";
+	int n = 0;
+	std::cin >> n;
+	std::cout << "Enter the minimum value:\t    ";
+	int minVal = 0;
+	std::cin >> minVal;
+	std::cout << "Enter the maximum value:\t    ";
+	int maxVal = 0;
+	std::cin >> maxVal;
+
+	// Generate random numbers of different distributions
+	Xorshift32 prng(1234);
+	std::cout << "\nGenerating " << n << " random numbers of each distribution:\n";
+	std::cout << std::setw(4) << "" << std::setw(12) << "Uniform" << std::setw(12) << "[0, 1)"
+		<< std::setw(12) << "Normal" << std::setw(12) << "Exponential" << std::endl;
+	std::cout << std::fixed << std::setprecision(4);
+	for (int i = 0; i < n; ++i) {
+		std::cout << std::setw(4) << i + 1 << std::setw(12) << uniformInt(prng, minVal, maxVal)
+			<< std::setw(12) << uniformDouble(prng) << std::setw(12) << normal(prng)
+			<< std::setw(12) << exponential(prng) << std::endl;
+	}
+	std::cout << std::endl;
+
+	// Compare with the standard library
+	std::cout << "Run the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) { benchmark(); }
+
+	// Exit
+	std::cout << "\nThanks for using this program! Have a great day!\n";
+	std::cout << "Press <Enter> to exit...";
+	std::cin.ignore();
+	std::cin.get();
+	return 0;
+}
@@ -8,7 +8,31 @@
 #define LCG_H
 
 
+// Note: shares a single global seed, so it is neither thread-safe nor able to run several streams
 unsigned long long lcg();
 
 
+// Same generator with its own state, which can also skip ahead and be split between threads
+class LCG {
+private:
+    static const unsigned long long a = 1664525;         // Multiplier
+    static const unsigned long long c = 1013904223;      // Increment
+    static const unsigned long long m = 4294967296;      // Modulus (2^32), also the period
+
+    unsigned long long state;
+    unsigned long long multiplier = a;                   // Multiplier of the current step, a^k for the leapfrog
+    unsigned long long increment = c;                    // Increment of the current step
+
+    static void compose(unsigned long long& mulA, unsigned long long& incA,
+                        unsigned long long mulB, unsigned long long incB);
+    static void power(unsigned long long steps, unsigned long long& mul, unsigned long long& inc);
+
+public:
+    LCG(unsigned long long initialSeed = 12345);
+    unsigned long long generate();
+    void skip(unsigned long long steps);
+    void leapfrog(unsigned long long thread, unsigned long long threadsCount);
+};
+
+
 #endif // LCG_H
@@ -10,10 +10,59 @@
 const unsigned long long a = 1664525;          // Multiplier
 const unsigned long long c = 1013904223;       // Increment
 const unsigned long long m = 4294967296;       // Modulus (2^32)
-unsigned long long seed = 12345;               // Initial seed
+static unsigned long long seed = 12345;        // Initial seed
 
 
 unsigned long long lcg() {
     seed = (a * seed + c) % m;
     return seed;
-}
\ No newline at end of file
+}
+
+
+LCG::LCG(unsigned long long initialSeed) : state(initialSeed % m) {}
+
+// Every step is an affine map x -> mul * x + inc (mod m), so a composition of two is one
+// as well: applying (mulA, incA) after (mulB, incB) gives (mulA * mulB, mulA * incB + incA)
+void LCG::compose(unsigned long long& mulA, unsigned long long& incA,
+                  unsigned long long mulB, unsigned long long incB) {
+    incA = (mulA * incB + incA) % m;
+    mulA = (mulA * mulB) % m;
+}
+
+// Map of 'steps' consecutive steps by exponentiation by squaring, which takes O(log steps)
+void LCG::power(unsigned long long steps, unsigned long long& mul, unsigned long long& inc) {
+    unsigned long long baseMul = a;
+    unsigned long long baseInc = c;
+    mul = 1;
+    inc = 0;
+    for (steps %= m; steps > 0; steps >>= 1) {
+        if (steps & 1) { compose(mul, inc, baseMul, baseInc); }
+        compose(baseMul, baseInc, baseMul, baseInc);
+    }
+}
+
+unsigned long long LCG::generate() {
+    state = (multiplier * state + increment) % m;
+    return state;
+}
+
+// Moves the state forward by the given number of steps of the original sequence; as it
+// repeats after m steps, moving back by k steps is the same as moving forward by m - k
+void LCG::skip(unsigned long long steps) {
+    unsigned long long mul = 0;
+    unsigned long long inc = 0;
+    power(steps, mul, inc);
+    state = (mul * state + inc) % m;
+}
+
+// Makes the generator return only every threadsCount-th number of the sequence starting
+// from the current state, beginning with the one at 'thread' (0-based), so that the numbers
+// of all threads together are exactly the original sequence, regardless of their count
+void LCG::leapfrog(unsigned long long thread, unsigned long long threadsCount) {
+    power(threadsCount, multiplier, increment);
+
+    // The next call of generate() has to land on the number at 'thread', one step of
+    // threadsCount ahead of where the state is placed
+    skip((thread + 1 + m - threadsCount % m) % m);
+}
+
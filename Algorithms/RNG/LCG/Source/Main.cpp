@@ -31,6 +31,24 @@ int main() {
 	}	
 	std::cout << std::endl;
 
+	// Split the same sequence between several threads, each one gets every 3rd number
+	const int threadsCount = 3;
+	std::cout << "Splitting the first " << n << " numbers between " << threadsCount << " threads (leapfrog):\n";
+	for (int t = 0; t < threadsCount; t++) {
+		LCG generator;
+		generator.leapfrog(t, threadsCount);
+		std::cout << " Thread " << t + 1 << ":";
+		for (int i = t; i < n; i += threadsCount) {
+			std::cout << "\t" << i + 1 << ": " << minVal + (generator.generate() % (maxVal - minVal + 1));
+		}
+		std::cout << std::endl;
+	}
+
+	// Skip ahead without generating the numbers in between
+	LCG generator;
+	generator.skip(1000000000);
+	std::cout << "\nNumber 1000000001 of the sequence: " << generator.generate() << std::endl;
+
 	// Exit
 	std::cout << "\nThanks for using this program! Have a great day!\n";
 	std::cout << "Press <Enter> to exit...";
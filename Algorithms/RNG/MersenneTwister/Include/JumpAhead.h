@@ -0,0 +1,30 @@
+// Title:   Header file for Jump-Ahead of Mersenne Twister
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef JUMPAHEAD_H
+#define JUMPAHEAD_H
+
+
+#include <cstdint>
+#include <vector>
+
+
+// Polynomials over GF(2) are stored as bits: coefficient of x^i is bit (i % 64) of word (i / 64)
+
+// Characteristic polynomial of the shortest linear recurrence that generates the given bits
+// (Berlekamp-Massey), 2 * degree bits are enough for a recurrence of a given degree
+std::vector<uint64_t> minimalPolynomial(const std::vector<uint8_t>& bits, int& degree);
+
+// Remainder of x^(2^power) divided by the modulus of the given degree
+std::vector<uint64_t> powerOfTwoModulo(const std::vector<uint64_t>& modulus, int degree, int power);
+
+// Coefficient of x^i
+inline bool coefficient(const std::vector<uint64_t>& polynomial, int i) {
+    return (polynomial[i / 64] >> (i % 64)) & 1u;
+}
+
+
+#endif // JUMPAHEAD_H
@@ -9,6 +9,7 @@
 
 
 #include <cstdint>
+#include <cstddef>
 #include <vector>
 
 
@@ -31,10 +32,17 @@ private:
 
     void initialize(uint32_t seed);
     void twist();
+    static void step(std::vector<uint32_t>& words, int& start);
 
 public:
     MersenneTwister(uint32_t seed = 5489u);  
     uint32_t generate();
+    void fill(uint32_t* out, size_t count);
+
+    // Jump-ahead by 2^power numbers, the polynomial can be computed once and reused
+    static std::vector<uint64_t> jumpPolynomial(int power);
+    void jump(const std::vector<uint64_t>& polynomial);
+    void jump(int power);
 };
 
 
@@ -0,0 +1,50 @@
+// Title:   Header file for Mersenne Twister (64-bit)
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef MERSENNETWISTER64_H
+#define MERSENNETWISTER64_H
+
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+
+class MersenneTwister64 {
+private:
+    static const int n = 312;                           // Length of the state array (number of 64-bit values in the internal state)
+    static const int m = 156;                           // Middle word; offset for mixing the state in the "twist" step
+    static const int r = 31;                            // Number of bits used to separate the lower and upper parts of the state
+    static const uint64_t a = 0xB5026F5AA96619E9ull;    // Constant used in the twisting transformation
+    static const int u = 29;                            // Shift used during the tempering process (right shift)
+    static const uint64_t d = 0x5555555555555555ull;    // Mask used together with the first shift of tempering
+    static const int s = 17;                            // Shift used during the tempering process (left shift)
+    static const int t = 37;                            // Another shift used in tempering (left shift)
+    static const int l = 43;                            // Final right shift in the tempering process
+    static const uint64_t b = 0x71D67FFFEDA60000ull;    // Mask used in the tempering process for bitwise AND
+    static const uint64_t c = 0xFFF7EEE000000000ull;    // Another mask used in the tempering process
+    static const uint64_t f = 6364136223846793005ull;   // Multiplier used during the initialization of the state array
+
+    std::vector<uint64_t> state;
+    int index = n + 1;
+
+    void initialize(uint64_t seed);
+    void twist();
+    static void step(std::vector<uint64_t>& words, int& start);
+
+public:
+    MersenneTwister64(uint64_t seed = 5489u);
+    uint64_t generate();
+    void fill(uint64_t* out, size_t count);
+
+    // Jump-ahead by 2^power numbers, the polynomial can be computed once and reused
+    static std::vector<uint64_t> jumpPolynomial(int power);
+    void jump(const std::vector<uint64_t>& polynomial);
+    void jump(int power);
+};
+
+
+#endif // MERSENNETWISTER64_H
@@ -0,0 +1,111 @@
+// Title:   Source file for Jump-Ahead of Mersenne Twister
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "JumpAhead.h"
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+static int parity(uint64_t x) { return static_cast<int>(__popcnt64(x) & 1u); }
+#else
+static int parity(uint64_t x) { return __builtin_parityll(x); }
+#endif
+
+
+// 64 bits of the packed bit array starting at the given bit position
+static uint64_t bitsAt(const std::vector<uint64_t>& bits, size_t pos) {
+    size_t word = pos / 64;
+    int shift = static_cast<int>(pos % 64);
+    if (shift == 0) { return bits[word]; }
+    return (bits[word] >> shift) | (bits[word + 1] << (64 - shift));
+}
+
+// target ^= source * x^shift
+static void addShifted(std::vector<uint64_t>& target, const std::vector<uint64_t>& source, size_t shift) {
+    size_t words = shift / 64;
+    int bitsShift = static_cast<int>(shift % 64);
+    for (size_t i = 0; i + words < target.size() && i < source.size(); i++) {
+        if (source[i] == 0) { continue; }
+        target[i + words] ^= source[i] << bitsShift;
+        if (bitsShift != 0 && i + words + 1 < target.size()) { target[i + words + 1] ^= source[i] >> (64 - bitsShift); }
+    }
+}
+
+std::vector<uint64_t> minimalPolynomial(const std::vector<uint8_t>& bits, int& degree) {
+    const size_t size = bits.size();
+    const size_t words = size / 64 + 2;
+
+    // Sequence is stored reversed, so that the terms s[k - i] for i = 0, 1, ... are consecutive
+    std::vector<uint64_t> reversed(words + 1, 0);
+    for (size_t i = 0; i < size; i++) {
+        if (bits[size - 1 - i]) { reversed[i / 64] |= uint64_t(1) << (i % 64); }
+    }
+
+    // Connection polynomials: current one and the one before the last length change
+    std::vector<uint64_t> current(words, 0);
+    std::vector<uint64_t> previous(words, 0);
+    current[0] = previous[0] = 1;
+    int length = 0;
+    long long lastChange = -1;
+
+    for (size_t k = 0; k < size; k++) {
+        // Discrepancy between s[k] and the value predicted by the current recurrence
+        uint64_t sum = 0;
+        size_t offset = size - 1 - k;
+        for (size_t w = 0; w * 64 <= static_cast<size_t>(length); w++) { sum ^= current[w] & bitsAt(reversed, offset + w * 64); }
+        if (!parity(sum)) { continue; }
+
+        if (2 * length <= static_cast<int>(k)) {
+            std::vector<uint64_t> saved = current;
+            addShifted(current, previous, static_cast<size_t>(k - lastChange));
+            previous = saved;
+            length = static_cast<int>(k) + 1 - length;
+            lastChange = static_cast<long long>(k);
+        } else {
+            addShifted(current, previous, static_cast<size_t>(k - lastChange));
+        }
+    }
+
+    // Characteristic polynomial is the connection one with reversed coefficients
+    degree = length;
+    std::vector<uint64_t> polynomial(length / 64 + 1, 0);
+    for (int i = 0; i <= length; i++) {
+        if (coefficient(current, length - i)) { polynomial[i / 64] |= uint64_t(1) << (i % 64); }
+    }
+    return polynomial;
+}
+
+std::vector<uint64_t> powerOfTwoModulo(const std::vector<uint64_t>& modulus, int degree, int power) {
+    const size_t words = degree / 64 + 1;
+
+    // Start from x itself, then square it 'power' times
+    std::vector<uint64_t> result(words, 0);
+    result[0] = 2;
+    std::vector<uint64_t> square(2 * words + 1, 0);
+    for (int p = 0; p < power; p++) {
+        // Squaring over GF(2) just spreads the bits: coefficient of x^i moves to x^(2i)
+        std::fill(square.begin(), square.end(), 0);
+        for (size_t w = 0; w < words; w++) {
+            for (int half = 0; half < 2; half++) {
+                uint64_t x = (result[w] >> (32 * half)) & 0xFFFFFFFFu;
+                x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+                x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+                x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+                x = (x | (x << 2)) & 0x3333333333333333ull;
+                x = (x | (x << 1)) & 0x5555555555555555ull;
+                square[2 * w + half] = x;
+            }
+        }
+
+        // Reduce from the highest term down, cancelling each one with a shifted modulus
+        for (int i = 2 * degree - 2; i >= degree; i--) {
+            if (coefficient(square, i)) { addShifted(square, modulus, i - degree); }
+        }
+        std::copy(square.begin(), square.begin() + words, result.begin());
+    }
+
+    return result;
+}
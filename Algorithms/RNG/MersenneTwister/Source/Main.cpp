@@ -5,7 +5,36 @@
 
 
 #include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
 #include "MersenneTwister.h"
+#include "MersenneTwister64.h"
+
+
+// Compares throughput of generating numbers one by one and in bulk,
+// both generators share the seed, so their outputs have to be identical
+void benchmark() {
+	const size_t count = 1 << 24;
+	std::vector<uint32_t> single(count);
+	std::vector<uint32_t> bulk(count);
+	MersenneTwister first(1234);
+	MersenneTwister second(1234);
+
+	auto t0 = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < count; i++) { single[i] = first.generate(); }
+	auto t1 = std::chrono::steady_clock::now();
+	second.fill(bulk.data(), count);
+	auto t2 = std::chrono::steady_clock::now();
+
+	double ms[2] = { std::chrono::duration<double, std::milli>(t1 - t0).count(),
+		std::chrono::duration<double, std::milli>(t2 - t1).count() };
+	std::cout << std::setw(12) << "Method" << std::setw(12) << "Time (ms)" << std::setw(16) << "Numbers/s (M)\n";
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << std::setw(12) << "generate()" << std::setw(12) << ms[0] << std::setw(15) << count / ms[0] / 1e3 << std::endl;
+	std::cout << std::setw(12) << "fill()" << std::setw(12) << ms[1] << std::setw(15) << count / ms[1] / 1e3
+		<< (single == bulk ? "" : "   (mismatch!)") << std::endl;
+}
 
 
 int main() {
@@ -32,6 +61,26 @@ int main() {
 	}
 	std::cout << std::endl;
 
+	// Split one 64-bit sequence into non-overlapping streams, e.g. one per worker thread
+	const int streamsCount = 4;
+	std::cout << "Splitting the 64-bit sequence into " << streamsCount << " streams, 2^64 numbers apart:\n";
+	std::vector<uint64_t> polynomial = MersenneTwister64::jumpPolynomial(64);
+	std::vector<MersenneTwister64> streams(streamsCount, MersenneTwister64(1234));
+	for (int i = 1; i < streamsCount; i++) {
+		streams[i] = streams[i - 1];
+		streams[i].jump(polynomial);
+	}
+	for (int i = 0; i < streamsCount; i++) {
+		std::cout << " " << i + 1 << ":\t" << streams[i].generate() << std::endl;
+	}
+	std::cout << std::endl;
+
+	// Compare with the bulk generation
+	std::cout << "Run the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) { benchmark(); }
+
 	// Exit
 	std::cout << "\nThanks for using this program! Have a great day!\n";
 	std::cout << "Press <Enter> to exit...";
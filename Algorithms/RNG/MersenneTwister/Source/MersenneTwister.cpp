@@ -5,6 +5,11 @@
 
 
 #include "MersenneTwister.h"
+#include "JumpAhead.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 
 MersenneTwister::MersenneTwister(uint32_t seed) { initialize(seed); }
@@ -19,16 +24,45 @@ void MersenneTwister::initialize(uint32_t seed) {
 }
 
 // Generates the next n numbers in the series
+// Note: the loop is split in three parts, so that (i + 1) and (i + m) never wrap around
+// and no modulo is needed; the first two parts process 8 elements at a time with AVX2
 void MersenneTwister::twist() {
     const uint32_t lowMask = (1u << r) - 1;
     const uint32_t upMask = ~lowMask;
+    uint32_t* mt = state.data();
+
+    // Single element: the lowest bit of x selects whether a is applied, without a branch
+    auto step = [&](int i, uint32_t next, uint32_t far) {
+        uint32_t x = (mt[i] & upMask) | (next & lowMask);
+        mt[i] = far ^ (x >> 1) ^ ((0u - (x & 1u)) & a);
+    };
+
+    // Eight elements: every one of them reads only values that are already final
+    // for this twist, as all dependencies are at least 8 positions away
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256i vUp = _mm256_set1_epi32(static_cast<int>(upMask));
+    const __m256i vLow = _mm256_set1_epi32(static_cast<int>(lowMask));
+    const __m256i vA = _mm256_set1_epi32(static_cast<int>(a));
+    const __m256i vOne = _mm256_set1_epi32(1);
+    auto steps = [&](int j, int farOffset) {
+        __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mt + j));
+        __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mt + j + 1));
+        __m256i far = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mt + j + farOffset));
+        __m256i x = _mm256_or_si256(_mm256_and_si256(cur, vUp), _mm256_and_si256(next, vLow));
+        __m256i odd = _mm256_cmpeq_epi32(_mm256_and_si256(x, vOne), vOne);
+        __m256i y = _mm256_xor_si256(_mm256_xor_si256(far, _mm256_srli_epi32(x, 1)), _mm256_and_si256(odd, vA));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(mt + j), y);
+    };
+    for (; i + 8 <= n - m; i += 8) { steps(i, m); }
+#endif
+    for (; i < n - m; i++) { step(i, mt[i + 1], mt[i + m]); }
+#if defined(__AVX2__)
+    for (; i + 8 <= n - 1; i += 8) { steps(i, m - n); }
+#endif
+    for (; i < n - 1; i++) { step(i, mt[i + 1], mt[i + m - n]); }
+    step(n - 1, mt[0], mt[m - 1]);
 
-    for (int i = 0; i < n; i++) {
-        uint32_t x = (state[i] & upMask) + (state[(i + 1) % n] & lowMask);
-        uint32_t xA = x >> 1;
-        if (x % 2 != 0) { xA ^= a; } // If the lowest bit is 1
-        state[i] = state[(i + m) % n] ^ xA;
-    }
     index = 0;
 }
 
@@ -43,4 +77,91 @@ uint32_t MersenneTwister::generate() {
     y ^= (y >> l);
 
     return y;
-}
\ No newline at end of file
+}
+
+// Writes the next 'count' numbers to 'out', exactly the same ones as 'count' calls of
+// generate() would return, tempering up to n of them at a time straight from the state
+void MersenneTwister::fill(uint32_t* out, size_t count) {
+    while (count > 0) {
+        if (index >= n) { twist(); }
+
+        size_t length = static_cast<size_t>(n - index);
+        if (length > count) { length = count; }
+        const uint32_t* from = state.data() + index;
+
+        size_t i = 0;
+#if defined(__AVX2__)
+        const __m256i vB = _mm256_set1_epi32(static_cast<int>(b));
+        const __m256i vC = _mm256_set1_epi32(static_cast<int>(c));
+        for (; i + 8 <= length; i += 8) {
+            __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + i));
+            y = _mm256_xor_si256(y, _mm256_srli_epi32(y, u));
+            y = _mm256_xor_si256(y, _mm256_and_si256(_mm256_slli_epi32(y, s), vB));
+            y = _mm256_xor_si256(y, _mm256_and_si256(_mm256_slli_epi32(y, t), vC));
+            y = _mm256_xor_si256(y, _mm256_srli_epi32(y, l));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), y);
+        }
+#endif
+        for (; i < length; i++) {
+            uint32_t y = from[i];
+            y ^= (y >> u);
+            y ^= (y << s) & b;
+            y ^= (y << t) & c;
+            y ^= (y >> l);
+            out[i] = y;
+        }
+
+        index += static_cast<int>(length);
+        out += length;
+        count -= length;
+    }
+}
+
+// Computes the next value of the sequence in a circular buffer, where words[start] is the
+// oldest value; it is not needed anymore, so the new one takes its place
+void MersenneTwister::step(std::vector<uint32_t>& words, int& start) {
+    const uint32_t lowMask = (1u << r) - 1;
+    uint32_t x = (words[start] & ~lowMask) | (words[(start + 1) % n] & lowMask);
+    words[start] = words[(start + m) % n] ^ (x >> 1) ^ ((0u - (x & 1u)) & a);
+    start = (start + 1) % n;
+}
+
+// The sequence is a linear recurrence over GF(2), so advancing it by J steps is the same as
+// applying (x^J mod p) to the state, where p is its characteristic polynomial of degree 19937;
+// p itself is recovered once from the output bits, as it is the same for every seed
+std::vector<uint64_t> MersenneTwister::jumpPolynomial(int power) {
+    static int degree = 0;
+    static const std::vector<uint64_t> characteristic = [] {
+        MersenneTwister generator;
+        std::vector<uint8_t> bits(2 * (n * 32 - r));
+        for (uint8_t& bit : bits) { bit = generator.generate() & 1u; }
+        return minimalPolynomial(bits, degree);
+    }();
+
+    return powerOfTwoModulo(characteristic, degree, power);
+}
+
+// Evaluates the polynomial at the transition with Horner's rule: acc = acc * T + c[i] * state
+void MersenneTwister::jump(const std::vector<uint64_t>& polynomial) {
+    // Bring the state to the circular form, where words (index + i) % n are the next values:
+    // the values before index are consumed, so they are replaced with the following ones
+    if (index >= n) { twist(); }
+    int start = 0;
+    for (int i = 0; i < index; i++) { step(state, start); }
+
+    std::vector<uint32_t> acc(n, 0);
+    int accStart = 0;
+    for (int i = static_cast<int>(polynomial.size()) * 64 - 1; i >= 0; i--) {
+        step(acc, accStart);
+        if (!coefficient(polynomial, i)) { continue; }
+        for (int j = 0; j < n; j++) { acc[(accStart + j) % n] ^= state[(start + j) % n]; }
+    }
+
+    // Any n consecutive values form a valid state right after twist
+    for (int j = 0; j < n; j++) { state[j] = acc[(accStart + j) % n]; }
+    index = 0;
+}
+
+// Note: computing the polynomial is the costly part, so jumping several generators
+// by the same distance is better done by computing it once
+void MersenneTwister::jump(int power) { jump(jumpPolynomial(power)); }
@@ -0,0 +1,116 @@
+// Title:   Source file for Mersenne Twister (64-bit)
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "MersenneTwister64.h"
+#include "JumpAhead.h"
+
+
+MersenneTwister64::MersenneTwister64(uint64_t seed) { initialize(seed); }
+
+// Initializes the state using linear recurrence method from the MT19937-64 algorithm
+void MersenneTwister64::initialize(uint64_t seed) {
+    state.resize(n);
+    state[0] = seed;
+    for (int i = 1; i < n; i++) {
+        state[i] = f * (state[i - 1] ^ (state[i - 1] >> 62)) + i;
+    }
+}
+
+// Generates the next n numbers in the series, split in three parts to avoid modulo
+void MersenneTwister64::twist() {
+    const uint64_t lowMask = (uint64_t(1) << r) - 1;
+    const uint64_t upMask = ~lowMask;
+    uint64_t* mt = state.data();
+
+    auto mix = [&](uint64_t current, uint64_t next) {
+        uint64_t x = (current & upMask) | (next & lowMask);
+        return (x >> 1) ^ ((0u - (x & 1u)) & a);
+    };
+
+    int i = 0;
+    for (; i < n - m; i++) { mt[i] = mt[i + m] ^ mix(mt[i], mt[i + 1]); }
+    for (; i < n - 1; i++) { mt[i] = mt[i + m - n] ^ mix(mt[i], mt[i + 1]); }
+    mt[n - 1] = mt[m - 1] ^ mix(mt[n - 1], mt[0]);
+
+    index = 0;
+}
+
+// Extracts a random number from the current state
+uint64_t MersenneTwister64::generate() {
+    if (index >= n) { twist(); }
+
+    uint64_t y = state[index++];
+    y ^= (y >> u) & d;
+    y ^= (y << s) & b;
+    y ^= (y << t) & c;
+    y ^= (y >> l);
+
+    return y;
+}
+
+// Writes the next 'count' numbers to 'out', exactly the same ones as 'count' calls of generate()
+void MersenneTwister64::fill(uint64_t* out, size_t count) {
+    while (count > 0) {
+        if (index >= n) { twist(); }
+
+        size_t length = static_cast<size_t>(n - index);
+        if (length > count) { length = count; }
+        const uint64_t* from = state.data() + index;
+        for (size_t i = 0; i < length; i++) {
+            uint64_t y = from[i];
+            y ^= (y >> u) & d;
+            y ^= (y << s) & b;
+            y ^= (y << t) & c;
+            y ^= (y >> l);
+            out[i] = y;
+        }
+
+        index += static_cast<int>(length);
+        out += length;
+        count -= length;
+    }
+}
+
+// Computes the next value of the sequence in a circular buffer, where words[start] is the oldest value
+void MersenneTwister64::step(std::vector<uint64_t>& words, int& start) {
+    const uint64_t lowMask = (uint64_t(1) << r) - 1;
+    uint64_t x = (words[start] & ~lowMask) | (words[(start + 1) % n] & lowMask);
+    words[start] = words[(start + m) % n] ^ (x >> 1) ^ ((0u - (x & 1u)) & a);
+    start = (start + 1) % n;
+}
+
+// Characteristic polynomial has degree 19937 as well and is recovered once from the output bits
+std::vector<uint64_t> MersenneTwister64::jumpPolynomial(int power) {
+    static int degree = 0;
+    static const std::vector<uint64_t> characteristic = [] {
+        MersenneTwister64 generator;
+        std::vector<uint8_t> bits(2 * (n * 64 - r));
+        for (uint8_t& bit : bits) { bit = generator.generate() & 1u; }
+        return minimalPolynomial(bits, degree);
+    }();
+
+    return powerOfTwoModulo(characteristic, degree, power);
+}
+
+// Evaluates the polynomial at the transition with Horner's rule: acc = acc * T + c[i] * state
+void MersenneTwister64::jump(const std::vector<uint64_t>& polynomial) {
+    if (index >= n) { twist(); }
+    int start = 0;
+    for (int i = 0; i < index; i++) { step(state, start); }
+
+    std::vector<uint64_t> acc(n, 0);
+    int accStart = 0;
+    for (int i = static_cast<int>(polynomial.size()) * 64 - 1; i >= 0; i--) {
+        step(acc, accStart);
+        if (!coefficient(polynomial, i)) { continue; }
+        for (int j = 0; j < n; j++) { acc[(accStart + j) % n] ^= state[(start + j) % n]; }
+    }
+
+    for (int j = 0; j < n; j++) { state[j] = acc[(accStart + j) % n]; }
+    index = 0;
+}
+
+void MersenneTwister64::jump(int power) { jump(jumpPolynomial(power)); }
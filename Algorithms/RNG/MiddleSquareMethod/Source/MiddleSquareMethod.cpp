@@ -8,7 +8,7 @@
 #include "MiddleSquareMethod.h"
 
 
-unsigned long long seed = 12345;
+static unsigned long long seed = 12345;
 const int digits = 4;
 
 
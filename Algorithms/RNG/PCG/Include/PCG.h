@@ -0,0 +1,68 @@
+// Title:   Header file for PCG
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef PCG_H
+#define PCG_H
+
+
+#include <cstdint>
+#include <cstddef>
+
+
+// Unsigned 128-bit integer for the state of PCG64, as it is not a standard type
+struct Uint128 {
+	uint64_t high;
+	uint64_t low;
+};
+
+
+// 64-bit LCG state, 32-bit output permuted with xorshift and random rotation (XSH-RR)
+class PCG32 {
+private:
+	static const uint64_t multiplier = 6364136223846793005ull;
+
+	uint64_t state;
+	uint64_t increment;   // Always odd, selects one of 2^63 different LCG sequences (streams)
+
+	friend class PCG32X8;
+
+public:
+	PCG32(uint64_t seed, uint64_t stream = 0);
+	uint32_t generate();
+	void advance(uint64_t delta);   // Jumps delta numbers ahead (or back modulo 2^64)
+};
+
+
+// 128-bit LCG state, 64-bit output permuted with xorshift and random rotation (XSL-RR)
+class PCG64 {
+private:
+	static const Uint128 multiplier;
+
+	Uint128 state;
+	Uint128 increment;
+
+public:
+	PCG64(Uint128 seed, Uint128 stream = { 0, 0 });
+	uint64_t generate();
+	void advance(Uint128 delta);    // Jumps delta numbers ahead (or back modulo 2^128)
+};
+
+
+// Eight PCG32 generators with seeds and streams derived from the given ones, advanced
+// together within AVX2 registers (plain loops without AVX2)
+class PCG32X8 {
+private:
+	alignas(32) uint64_t state[8];
+	alignas(32) uint64_t increment[8];
+
+public:
+	PCG32X8(uint64_t seed, uint64_t stream = 0);
+	void generate(uint32_t out[8]);
+	void fill(uint32_t* out, size_t count);
+};
+
+
+#endif // PCG_H
@@ -0,0 +1,205 @@
+// Title:   Source file for PCG
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "PCG.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+// ----------------
+// 128-bit Helpers
+// ----------------
+
+// Full 128-bit product of two 64-bit numbers
+static Uint128 multiply(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+	return { static_cast<uint64_t>(product >> 64), static_cast<uint64_t>(product) };
+#else
+	// Schoolbook multiplication by 32-bit halves
+	uint64_t aLow = a & 0xFFFFFFFFu, aHigh = a >> 32;
+	uint64_t bLow = b & 0xFFFFFFFFu, bHigh = b >> 32;
+	uint64_t lowLow = aLow * bLow;
+	uint64_t highLow = aHigh * bLow;
+	uint64_t lowHigh = aLow * bHigh;
+	uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFu) + lowHigh;
+	return { aHigh * bHigh + (highLow >> 32) + (middle >> 32), (middle << 32) | (lowLow & 0xFFFFFFFFu) };
+#endif
+}
+
+// Lower 128 bits of the product, the rest overflows just like with built-in types
+static Uint128 multiply(Uint128 a, Uint128 b) {
+	Uint128 result = multiply(a.low, b.low);
+	result.high += a.high * b.low + a.low * b.high;
+	return result;
+}
+
+static Uint128 add(Uint128 a, Uint128 b) {
+	Uint128 result = { a.high + b.high, a.low + b.low };
+	result.high += (result.low < a.low);
+	return result;
+}
+
+
+// -----
+// PCG32
+// -----
+
+static uint32_t output32(uint64_t state) {
+	uint32_t xorShifted = static_cast<uint32_t>(((state >> 18) ^ state) >> 27);
+	uint32_t rotation = static_cast<uint32_t>(state >> 59);
+	return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31));
+}
+
+// Same initialization as in the reference implementation, so the sequences match
+PCG32::PCG32(uint64_t seed, uint64_t stream) : state(0), increment((stream << 1) | 1u) {
+	generate();
+	state += seed;
+	generate();
+}
+
+// Output is computed from the old state, so it does not wait for the multiplication
+uint32_t PCG32::generate() {
+	uint64_t old = state;
+	state = old * multiplier + increment;
+	return output32(old);
+}
+
+// The step is an affine map x -> a * x + c, so delta steps are a single affine map
+// computed by exponentiation by squaring in O(log delta) (Brown's algorithm)
+void PCG32::advance(uint64_t delta) {
+	uint64_t accMul = 1, accAdd = 0;
+	uint64_t curMul = multiplier, curAdd = increment;
+	for (; delta > 0; delta >>= 1) {
+		if (delta & 1) {
+			accMul *= curMul;
+			accAdd = accAdd * curMul + curAdd;
+		}
+		curAdd = (curMul + 1) * curAdd;
+		curMul *= curMul;
+	}
+	state = accMul * state + accAdd;
+}
+
+
+// -----
+// PCG64
+// -----
+
+const Uint128 PCG64::multiplier = { 2549297995355413924ull, 4865540595714422341ull };
+
+static uint64_t output64(Uint128 state) {
+	uint64_t x = state.high ^ state.low;
+	unsigned rotation = static_cast<unsigned>(state.high >> 58);
+	return (x >> rotation) | (x << ((0u - rotation) & 63));
+}
+
+PCG64::PCG64(Uint128 seed, Uint128 stream) {
+	state = { 0, 0 };
+	increment = { (stream.high << 1) | (stream.low >> 63), (stream.low << 1) | 1u };
+	generate();
+	state = add(state, seed);
+	generate();
+}
+
+// Output is computed from the new state, as in the reference implementation for 128 bits
+uint64_t PCG64::generate() {
+	state = add(multiply(state, multiplier), increment);
+	return output64(state);
+}
+
+void PCG64::advance(Uint128 delta) {
+	Uint128 accMul = { 0, 1 }, accAdd = { 0, 0 };
+	Uint128 curMul = multiplier, curAdd = increment;
+	while (delta.high != 0 || delta.low != 0) {
+		if (delta.low & 1) {
+			accMul = multiply(accMul, curMul);
+			accAdd = add(multiply(accAdd, curMul), curAdd);
+		}
+		curAdd = multiply(add(curMul, { 0, 1 }), curAdd);
+		curMul = multiply(curMul, curMul);
+		delta.low = (delta.low >> 1) | (delta.high << 63);
+		delta.high >>= 1;
+	}
+	state = add(multiply(accMul, state), accAdd);
+}
+
+
+// -------
+// PCG32X8
+// -------
+
+// Expands the seed and the stream into unrelated words for the lanes
+static uint64_t splitMix64(uint64_t& x) {
+	uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+// Lanes with the same seed on neighbouring streams would have closely related states, so every
+// lane gets both its own seed and its own stream, drawn from SplitMix64
+PCG32X8::PCG32X8(uint64_t seed, uint64_t stream) {
+	uint64_t mixer = stream;
+	mixer = seed ^ splitMix64(mixer);
+	for (int lane = 0; lane < 8; lane++) {
+		uint64_t laneSeed = splitMix64(mixer);
+		PCG32 generator(laneSeed, splitMix64(mixer));
+		state[lane] = generator.state;
+		increment[lane] = generator.increment;
+	}
+}
+
+// Writes the next number of each lane, exactly the same steps as the scalar version
+void PCG32X8::generate(uint32_t out[8]) {
+#if defined(__AVX2__)
+	const __m256i mulLow = _mm256_set1_epi64x(static_cast<long long>(PCG32::multiplier & 0xFFFFFFFFu));
+	const __m256i mulHigh = _mm256_set1_epi64x(static_cast<long long>(PCG32::multiplier >> 32));
+	const __m256i lowMask = _mm256_set1_epi64x(0xFFFFFFFFll);
+	const __m256i thirtyTwo = _mm256_set1_epi64x(32);
+	const __m256i gather = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+	for (int half = 0; half < 2; half++) {
+		__m256i old = _mm256_load_si256(reinterpret_cast<const __m256i*>(state + 4 * half));
+		__m256i inc = _mm256_load_si256(reinterpret_cast<const __m256i*>(increment + 4 * half));
+
+		// There is no 64-bit multiplication in AVX2, so it is built from 32-bit ones:
+		// low * low + ((high * low + low * high) << 32), the rest overflows anyway
+		__m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(old, 32), mulLow), _mm256_mul_epu32(old, mulHigh));
+		__m256i product = _mm256_add_epi64(_mm256_mul_epu32(old, mulLow), _mm256_slli_epi64(cross, 32));
+		_mm256_store_si256(reinterpret_cast<__m256i*>(state + 4 * half), _mm256_add_epi64(product, inc));
+
+		// Rotations differ between lanes, which variable shifts allow; the bits shifted
+		// past 32 are dropped, as only the lower halves of the lanes are packed
+		__m256i xorShifted = _mm256_and_si256(_mm256_srli_epi64(_mm256_xor_si256(_mm256_srli_epi64(old, 18), old), 27), lowMask);
+		__m256i rotation = _mm256_srli_epi64(old, 59);
+		__m256i rotated = _mm256_or_si256(_mm256_srlv_epi64(xorShifted, rotation),
+			_mm256_sllv_epi64(xorShifted, _mm256_sub_epi64(thirtyTwo, rotation)));
+		__m256i packed = _mm256_permutevar8x32_epi32(rotated, gather);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4 * half), _mm256_castsi256_si128(packed));
+	}
+#else
+	for (int lane = 0; lane < 8; lane++) {
+		uint64_t old = state[lane];
+		state[lane] = old * PCG32::multiplier + increment[lane];
+		out[lane] = output32(old);
+	}
+#endif
+}
+
+// Fills the buffer with numbers of the lanes interleaved: lane (i % 8) produced out[i];
+// numbers of the last block that do not fit are discarded
+void PCG32X8::fill(uint32_t* out, size_t count) {
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) { generate(out + i); }
+	if (i < count) {
+		uint32_t block[8];
+		generate(block);
+		for (int j = 0; i < count; i++, j++) { out[i] = block[j]; }
+	}
+}
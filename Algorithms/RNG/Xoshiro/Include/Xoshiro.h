@@ -0,0 +1,71 @@
+// Title:   Header file for Xoshiro
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef XOSHIRO_H
+#define XOSHIRO_H
+
+
+#include <cstdint>
+#include <cstddef>
+
+
+// 256-bit state, 64-bit output scrambled with multiplications, period 2^256 - 1
+class Xoshiro256StarStar {
+private:
+	uint64_t state[4];
+
+	friend class Xoshiro256StarStarX4;
+
+public:
+	explicit Xoshiro256StarStar(uint64_t seed);
+	uint64_t generate();
+	void jump();       // 2^128 numbers ahead
+	void longJump();   // 2^192 numbers ahead
+};
+
+
+// 128-bit state, 32-bit output scrambled with an addition, period 2^128 - 1
+// Note: the lowest bits are of lower quality, so it suits floating-point generation best
+class Xoshiro128Plus {
+private:
+	uint32_t state[4];
+
+	friend class Xoshiro128PlusX8;
+
+public:
+	explicit Xoshiro128Plus(uint64_t seed);
+	uint32_t generate();
+	void jump();       // 2^64 numbers ahead
+	void longJump();   // 2^96 numbers ahead
+};
+
+
+// Four interleaved Xoshiro256** generators, each one 2^128 numbers ahead of the previous,
+// advanced together within a single AVX2 register (plain loops without AVX2)
+class Xoshiro256StarStarX4 {
+private:
+	alignas(32) uint64_t state[4][4];   // [word][lane]
+
+public:
+	explicit Xoshiro256StarStarX4(uint64_t seed);
+	void generate(uint64_t out[4]);
+	void fill(uint64_t* out, size_t count);
+};
+
+
+// Eight interleaved Xoshiro128+ generators, each one 2^64 numbers ahead of the previous
+class Xoshiro128PlusX8 {
+private:
+	alignas(32) uint32_t state[4][8];   // [word][lane]
+
+public:
+	explicit Xoshiro128PlusX8(uint64_t seed);
+	void generate(uint32_t out[8]);
+	void fill(uint32_t* out, size_t count);
+};
+
+
+#endif // XOSHIRO_H
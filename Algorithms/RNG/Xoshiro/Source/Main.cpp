@@ -0,0 +1,100 @@
+// Title:   Xoshiro Algorithm
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include "Xoshiro.h"
+
+
+// Measures time of generating 'count' numbers of the given type with 'generate',
+// which writes them into the buffer; the checksum prevents the work from being optimized out
+template <typename Word, typename Generate>
+void measure(const std::string& name, size_t count, Generate generate) {
+	std::vector<Word> buffer(count);
+	auto start = std::chrono::steady_clock::now();
+	generate(buffer.data(), count);
+	auto end = std::chrono::steady_clock::now();
+
+	Word checksum = 0;
+	for (Word x : buffer) { checksum ^= x; }
+	double seconds = std::chrono::duration<double>(end - start).count();
+	std::cout << std::setw(24) << name << std::fixed << std::setprecision(1)
+		<< std::setw(16) << count / seconds / 1e6 << std::setw(10) << count * sizeof(Word) / seconds / 1e9
+		<< "   (checksum " << std::hex << static_cast<unsigned long long>(checksum) << std::dec << ")" << std::endl;
+}
+
+// Compares throughput of the scalar and multi-lane generators
+void benchmark() {
+	const size_t count = 1 << 24;
+	std::cout << std::setw(24) << "Generator" << std::setw(16) << "Numbers/s (M)" << std::setw(10) << "GB/s" << std::endl;
+	measure<uint64_t>("Xoshiro256**", count, [](uint64_t* out, size_t size) {
+		Xoshiro256StarStar generator(1234);
+		for (size_t i = 0; i < size; i++) { out[i] = generator.generate(); }
+	});
+	measure<uint64_t>("Xoshiro256** (4 lanes)", count, [](uint64_t* out, size_t size) {
+		Xoshiro256StarStarX4 generator(1234);
+		generator.fill(out, size);
+	});
+	measure<uint32_t>("Xoshiro128+", count, [](uint32_t* out, size_t size) {
+		Xoshiro128Plus generator(1234);
+		for (size_t i = 0; i < size; i++) { out[i] = generator.generate(); }
+	});
+	measure<uint32_t>("Xoshiro128+ (8 lanes)", count, [](uint32_t* out, size_t size) {
+		Xoshiro128PlusX8 generator(1234);
+		generator.fill(out, size);
+	});
+}
+
+int main() {
+	// Greet
+	std::cout << "\tWelcome to the 'Xoshiro' console application!\n\n";
+
+	// Prompt the user for input
+	std::cout << "Enter the number of random numbers: ";
+	int n = 0;
+	std::cin >> n;
+	std::cout << "Enter the minimum value:\t    ";
+	int minVal = 0;
+	std::cin >> minVal;
+	std::cout << "Enter the maximum value:\t    ";
+	int maxVal = 0;
+	std::cin >> maxVal;
+
+	// Generate random numbers within the user-defined range
+	Xoshiro256StarStar prng(1234);
+	std::cout << "\nGenerating " << n << " random numbers between " << minVal << " and " << maxVal << ":\n";
+	for (int i = 0; i < n; ++i) {
+		uint64_t randomNumber = minVal + (prng.generate() % (maxVal - minVal + 1));
+		std::cout << " " << i + 1 << ":\t" << randomNumber << std::endl;
+	}
+	std::cout << std::endl;
+
+	// Split the sequence into non-overlapping parts, e.g. one per worker thread
+	std::cout << "Jumping 2^128 numbers ahead for each of 4 threads:\n";
+	Xoshiro256StarStar stream(1234);
+	for (int i = 0; i < 4; i++) {
+		Xoshiro256StarStar copy = stream;
+		std::cout << " " << i + 1 << ":\t" << copy.generate() << std::endl;
+		stream.jump();
+	}
+	std::cout << std::endl;
+
+	// Compare the generators
+	std::cout << "Run the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) { benchmark(); }
+
+	// Exit
+	std::cout << "\nThanks for using this program! Have a great day!\n";
+	std::cout << "Press <Enter> to exit...";
+	std::cin.ignore();
+	std::cin.get();
+	return 0;
+}
@@ -0,0 +1,240 @@
+// Title:   Source file for Xoshiro
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "Xoshiro.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+static uint32_t rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+// Expands a single seed into well-mixed state words, so that similar seeds give unrelated
+// states and the state is never all zeros, as recommended by the authors of the algorithm
+static uint64_t splitMix64(uint64_t& x) {
+	uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+// Jumps are linear transformations of the state, so they are computed as a sum (XOR) of the
+// states, which the generator passes through, selected by the bits of precomputed polynomial
+template <typename Generator, typename Word>
+static void jumpBy(Generator& generator, Word state[4], const Word polynomial[4]) {
+	Word result[4] = { 0, 0, 0, 0 };
+	for (int i = 0; i < 4; i++) {
+		for (int b = 0; b < static_cast<int>(sizeof(Word) * 8); b++) {
+			if ((polynomial[i] >> b) & 1u) {
+				for (int j = 0; j < 4; j++) { result[j] ^= state[j]; }
+			}
+			generator.generate();
+		}
+	}
+	for (int j = 0; j < 4; j++) { state[j] = result[j]; }
+}
+
+
+// ------------------
+// Xoshiro256StarStar
+// ------------------
+
+Xoshiro256StarStar::Xoshiro256StarStar(uint64_t seed) {
+	for (uint64_t& word : state) { word = splitMix64(seed); }
+}
+
+uint64_t Xoshiro256StarStar::generate() {
+	const uint64_t result = rotl(state[1] * 5, 7) * 9;
+	const uint64_t t = state[1] << 17;
+
+	state[2] ^= state[0];
+	state[3] ^= state[1];
+	state[1] ^= state[2];
+	state[0] ^= state[3];
+	state[2] ^= t;
+	state[3] = rotl(state[3], 45);
+
+	return result;
+}
+
+void Xoshiro256StarStar::jump() {
+	static const uint64_t polynomial[4] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+	jumpBy(*this, state, polynomial);
+}
+
+void Xoshiro256StarStar::longJump() {
+	static const uint64_t polynomial[4] = { 0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull };
+	jumpBy(*this, state, polynomial);
+}
+
+
+// --------------
+// Xoshiro128Plus
+// --------------
+
+Xoshiro128Plus::Xoshiro128Plus(uint64_t seed) {
+	for (int i = 0; i < 4; i += 2) {
+		uint64_t word = splitMix64(seed);
+		state[i] = static_cast<uint32_t>(word);
+		state[i + 1] = static_cast<uint32_t>(word >> 32);
+	}
+}
+
+uint32_t Xoshiro128Plus::generate() {
+	const uint32_t result = state[0] + state[3];
+	const uint32_t t = state[1] << 9;
+
+	state[2] ^= state[0];
+	state[3] ^= state[1];
+	state[1] ^= state[2];
+	state[0] ^= state[3];
+	state[2] ^= t;
+	state[3] = rotl(state[3], 11);
+
+	return result;
+}
+
+void Xoshiro128Plus::jump() {
+	static const uint32_t polynomial[4] = { 0x8764000Bu, 0xF542D2D3u, 0x6FA035C3u, 0x77F2DB5Bu };
+	jumpBy(*this, state, polynomial);
+}
+
+void Xoshiro128Plus::longJump() {
+	static const uint32_t polynomial[4] = { 0xB523952Eu, 0x0B6F099Fu, 0xCCF5A0EFu, 0x1C580662u };
+	jumpBy(*this, state, polynomial);
+}
+
+
+// --------------------
+// Xoshiro256StarStarX4
+// --------------------
+
+// Lane i continues where lane i - 1 would be after 2^128 numbers, so lanes never overlap
+Xoshiro256StarStarX4::Xoshiro256StarStarX4(uint64_t seed) {
+	Xoshiro256StarStar generator(seed);
+	for (int lane = 0; lane < 4; lane++) {
+		for (int j = 0; j < 4; j++) { state[j][lane] = generator.state[j]; }
+		generator.jump();
+	}
+}
+
+// Writes the next number of each lane, exactly the same steps as the scalar version
+void Xoshiro256StarStarX4::generate(uint64_t out[4]) {
+#if defined(__AVX2__)
+	__m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[0]));
+	__m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[1]));
+	__m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[2]));
+	__m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[3]));
+
+	// There is no 64-bit multiplication in AVX2, but x * 5 = x + (x << 2) and x * 9 = x + (x << 3)
+	__m256i x = _mm256_add_epi64(s1, _mm256_slli_epi64(s1, 2));
+	x = _mm256_or_si256(_mm256_slli_epi64(x, 7), _mm256_srli_epi64(x, 57));
+	x = _mm256_add_epi64(x, _mm256_slli_epi64(x, 3));
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), x);
+
+	__m256i t = _mm256_slli_epi64(s1, 17);
+	s2 = _mm256_xor_si256(s2, s0);
+	s3 = _mm256_xor_si256(s3, s1);
+	s1 = _mm256_xor_si256(s1, s2);
+	s0 = _mm256_xor_si256(s0, s3);
+	s2 = _mm256_xor_si256(s2, t);
+	s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+
+	_mm256_store_si256(reinterpret_cast<__m256i*>(state[0]), s0);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(state[1]), s1);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(state[2]), s2);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(state[3]), s3);
+#else
+	for (int lane = 0; lane < 4; lane++) {
+		uint64_t* s[4] = { &state[0][lane], &state[1][lane], &state[2][lane], &state[3][lane] };
+		out[lane] = rotl(*s[1] * 5, 7) * 9;
+		const uint64_t t = *s[1] << 17;
+		*s[2] ^= *s[0];
+		*s[3] ^= *s[1];
+		*s[1] ^= *s[2];
+		*s[0] ^= *s[3];
+		*s[2] ^= t;
+		*s[3] = rotl(*s[3], 45);
+	}
+#endif
+}
+
+// Fills the buffer with numbers of the lanes interleaved: lane (i % 4) produced out[i];
+// numbers of the last block that do not fit are discarded
+void Xoshiro256StarStarX4::fill(uint64_t* out, size_t count) {
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) { generate(out + i); }
+	if (i < count) {
+		uint64_t block[4];
+		generate(block);
+		for (int j = 0; i < count; i++, j++) { out[i] = block[j]; }
+	}
+}
+
+
+// ----------------
+// Xoshiro128PlusX8
+// ----------------
+
+// Lane i continues where lane i - 1 would be after 2^64 numbers, so lanes never overlap
+Xoshiro128PlusX8::Xoshiro128PlusX8(uint64_t seed) {
+	Xoshiro128Plus generator(seed);
+	for (int lane = 0; lane < 8; lane++) {
+		for (int j = 0; j < 4; j++) { state[j][lane] = generator.state[j]; }
+		generator.jump();
+	}
+}
+
+// Writes the next number of each lane, exactly the same steps as the scalar version
+void Xoshiro128PlusX8::generate(uint32_t out[8]) {
+#if defined(__AVX2__)
+	__m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[0]));
+	__m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[1]));
+	__m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[2]));
+	__m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[3]));
+
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_add_epi32(s0, s3));
+
+	__m256i t = _mm256_slli_epi32(s1, 9);
+	s2 = _mm256_xor_si256(s2, s0);
+	s3 = _mm256_xor_si256(s3, s1);
+	s1 = _mm256_xor_si256(s1, s2);
+	s0 = _mm256_xor_si256(s0, s3);
+	s2 = _mm256_xor_si256(s2, t);
+	s3 = _mm256_or_si256(_mm256_slli_epi32(s3, 11), _mm256_srli_epi32(s3, 21));
+
+	_mm256_store_si256(reinterpret_cast<__m256i*>(state[0]), s0);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(state[1]), s1);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(state[2]), s2);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(state[3]), s3);
+#else
+	for (int lane = 0; lane < 8; lane++) {
+		uint32_t* s[4] = { &state[0][lane], &state[1][lane], &state[2][lane], &state[3][lane] };
+		out[lane] = *s[0] + *s[3];
+		const uint32_t t = *s[1] << 9;
+		*s[2] ^= *s[0];
+		*s[3] ^= *s[1];
+		*s[1] ^= *s[2];
+		*s[0] ^= *s[3];
+		*s[2] ^= t;
+		*s[3] = rotl(*s[3], 11);
+	}
+#endif
+}
+
+// Fills the buffer with numbers of the lanes interleaved: lane (i % 8) produced out[i];
+// numbers of the last block that do not fit are discarded
+void Xoshiro128PlusX8::fill(uint32_t* out, size_t count) {
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) { generate(out + i); }
+	if (i < count) {
+		uint32_t block[8];
+		generate(block);
+		for (int j = 0; i < count; i++, j++) { out[i] = block[j]; }
+	}
+}
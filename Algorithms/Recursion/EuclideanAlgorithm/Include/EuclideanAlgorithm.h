@@ -8,7 +8,48 @@
 #define EUCLIDEAN_H
 
 
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
 int euclidean(int a, int b);
 
 
+// ---------------
+// 64-Bit Variants
+// ---------------
+
+// Same steps in a loop, without the calls
+uint64_t euclideanIterative(uint64_t a, uint64_t b);
+
+// Stein's algorithm: removes common powers of two and then only subtracts and shifts odd numbers,
+// counting trailing zeros to do all shifts of a step at once, so there is no division at all
+uint64_t binaryGcd(uint64_t a, uint64_t b);
+
+// Also finds x and y with a * x + b * y = gcd(a, b) (Bezout's identity)
+int64_t extendedEuclidean(int64_t a, int64_t b, int64_t& x, int64_t& y);
+
+// x with a * x = 1 (mod modulus), or 0 if a and modulus aren't coprime; Note: requires modulus < 2^63
+uint64_t modularInverse(uint64_t a, uint64_t modulus);
+
+// result[i] = gcd(a[i], b[i]), computing four pairs at once with AVX2
+void binaryGcdBatch(const uint64_t* a, const uint64_t* b, uint64_t* result, size_t count);
+
+
+// -----------
+// Big Numbers
+// -----------
+
+using Limbs = std::vector<uint32_t>;   // Digits of base 2^32, starting from the lowest one
+
+Limbs toLimbs(const std::string& decimal);
+std::string toDecimal(Limbs number);
+
+// Lehmer's algorithm: runs Euclid's steps on the leading 62 bits only, collects them into a 2x2 matrix
+// and applies it to the whole numbers at once, so most steps cost nothing
+Limbs lehmerGcd(Limbs a, Limbs b);
+
+
 #endif // EUCLIDEAN_H
\ No newline at end of file
@@ -5,9 +5,320 @@
 
 
 #include "EuclideanAlgorithm.h"
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+static int countTrailingZeros(uint64_t x) { unsigned long i; _BitScanForward64(&i, x); return static_cast<int>(i); }
+static int bitWidth(uint32_t x) { unsigned long i; return _BitScanReverse(&i, x) ? static_cast<int>(i) + 1 : 0; }
+#else
+static int countTrailingZeros(uint64_t x) { return __builtin_ctzll(x); }
+static int bitWidth(uint32_t x) { return x ? 32 - __builtin_clz(x) : 0; }
+#endif
 
 
 int euclidean(int a, int b) {
 	if (b == 0) { return a; }
 	return euclidean(b, a % b);
+}
+
+
+// ---------------
+// 64-Bit Variants
+// ---------------
+
+uint64_t euclideanIterative(uint64_t a, uint64_t b) {
+	while (b != 0) {
+		uint64_t remainder = a % b;
+		a = b;
+		b = remainder;
+	}
+	return a;
+}
+
+// gcd(2a, 2b) = 2gcd(a, b), gcd(2a, b) = gcd(a, b) for odd b, and gcd(a, b) = gcd(|a - b|, min(a, b)) for odd a and b;
+// the zeros of the difference are counted before the minimum is taken, so the steps have no branches
+uint64_t binaryGcd(uint64_t a, uint64_t b) {
+	if (a == 0) { return b; }
+	if (b == 0) { return a; }
+	int shift = countTrailingZeros(a | b);
+	int zeros = countTrailingZeros(a);
+	b >>= countTrailingZeros(b);
+	while (a != 0) {
+		a >>= zeros;
+		uint64_t difference = b - a;   // Same trailing zeros as |a - b|, the highest bit only guards a zero one
+		zeros = countTrailingZeros(difference | (uint64_t(1) << 63));
+		uint64_t smaller = a < b ? a : b;
+		a = a < b ? b - a : a - b;
+		b = smaller;
+	}
+	return b << shift;
+}
+
+int64_t extendedEuclidean(int64_t a, int64_t b, int64_t& x, int64_t& y) {
+	int64_t previousX = 1, currentX = 0;
+	int64_t previousY = 0, currentY = 1;
+	while (b != 0) {
+		int64_t quotient = a / b;
+		int64_t remainder = a - quotient * b;
+		a = b;
+		b = remainder;
+		int64_t nextX = previousX - quotient * currentX;
+		previousX = currentX;
+		currentX = nextX;
+		int64_t nextY = previousY - quotient * currentY;
+		previousY = currentY;
+		currentY = nextY;
+	}
+	x = previousX;
+	y = previousY;
+	return a;
+}
+
+uint64_t modularInverse(uint64_t a, uint64_t modulus) {
+	int64_t x = 0, y = 0;
+	if (extendedEuclidean(static_cast<int64_t>(a % modulus), static_cast<int64_t>(modulus), x, y) != 1) { return 0; }
+	return static_cast<uint64_t>(x < 0 ? x + static_cast<int64_t>(modulus) : x);
+}
+
+#if defined(__AVX2__)
+// Trailing zeros in every 64-bit lane: the lowest set bit is converted to float in both 32-bit halves,
+// so the exponent gives its position (a zero half gives a negative one, and a zero lane - a huge shift)
+static __m256i countTrailingZeros4(__m256i x) {
+	__m256i lowest = _mm256_and_si256(x, _mm256_sub_epi64(_mm256_setzero_si256(), x));
+	__m256i exponents = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(lowest)), 23);
+	exponents = _mm256_and_si256(exponents, _mm256_set1_epi32(0xFF));
+	exponents = _mm256_sub_epi32(exponents, _mm256_set_epi32(95, 127, 95, 127, 95, 127, 95, 127));
+	exponents = _mm256_max_epi32(exponents, _mm256_shuffle_epi32(exponents, 0xB1));
+	return _mm256_and_si256(exponents, _mm256_set1_epi64x(0xFFFFFFFF));
+}
+#endif
+
+// Lanes run the same steps as binaryGcd(), while finished ones (with a = 0) are kept by the masks until all are done;
+// four groups of four pairs are interleaved, so that the long dependency chain of one hides behind the others
+void binaryGcdBatch(const uint64_t* a, const uint64_t* b, uint64_t* result, size_t count) {
+	size_t i = 0;
+#if defined(__AVX2__)
+	const int groups = 4;
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i signBit = _mm256_set1_epi64x(INT64_MIN);
+	for (; i + 4 * groups <= count; i += 4 * groups) {
+		__m256i x[groups], y[groups], zeros[groups], shift[groups];
+		for (int g = 0; g < groups; g++) {
+			x[g] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 4 * g));
+			y[g] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 4 * g));
+
+			// With a zero operand the other one is the answer, so it's moved to y and the lane is finished
+			__m256i anyZero = _mm256_or_si256(_mm256_cmpeq_epi64(x[g], zero), _mm256_cmpeq_epi64(y[g], zero));
+			y[g] = _mm256_blendv_epi8(y[g], _mm256_or_si256(x[g], y[g]), anyZero);
+			x[g] = _mm256_andnot_si256(anyZero, x[g]);
+			shift[g] = countTrailingZeros4(_mm256_or_si256(x[g], y[g]));
+			zeros[g] = countTrailingZeros4(x[g]);
+			y[g] = _mm256_srlv_epi64(y[g], countTrailingZeros4(y[g]));
+		}
+
+		while (true) {
+			__m256i done[groups];
+			int finished = 0;
+			for (int g = 0; g < groups; g++) {
+				done[g] = _mm256_cmpeq_epi64(x[g], zero);
+				finished += _mm256_movemask_epi8(done[g]) == -1;
+			}
+			if (finished == groups) { break; }
+
+			for (int g = 0; g < groups; g++) {
+				x[g] = _mm256_srlv_epi64(x[g], zeros[g]);
+				__m256i difference = _mm256_sub_epi64(y[g], x[g]);
+				zeros[g] = countTrailingZeros4(difference);
+				// There is no unsigned 64-bit comparison, so the signed one is used with flipped sign bits
+				__m256i greater = _mm256_cmpgt_epi64(_mm256_xor_si256(x[g], signBit), _mm256_xor_si256(y[g], signBit));
+				__m256i smaller = _mm256_blendv_epi8(x[g], y[g], greater);
+				__m256i larger = _mm256_blendv_epi8(y[g], x[g], greater);
+				x[g] = _mm256_andnot_si256(done[g], _mm256_sub_epi64(larger, smaller));
+				y[g] = _mm256_blendv_epi8(smaller, y[g], done[g]);
+			}
+		}
+		for (int g = 0; g < groups; g++) {
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i + 4 * g), _mm256_sllv_epi64(y[g], shift[g]));
+		}
+	}
+#endif
+	for (; i < count; i++) { result[i] = binaryGcd(a[i], b[i]); }
+}
+
+
+// -----------
+// Big Numbers
+// -----------
+
+static void trim(Limbs& number) {
+	while (!number.empty() && number.back() == 0) { number.pop_back(); }
+}
+
+static int compare(const Limbs& a, const Limbs& b) {
+	if (a.size() != b.size()) { return a.size() < b.size() ? -1 : 1; }
+	for (size_t i = a.size(); i-- > 0;) {
+		if (a[i] != b[i]) { return a[i] < b[i] ? -1 : 1; }
+	}
+	return 0;
+}
+
+static int bitLength(const Limbs& number) {
+	return number.empty() ? 0 : 32 * static_cast<int>(number.size() - 1) + bitWidth(number.back());
+}
+
+static Limbs shiftLeft(const Limbs& number, int shift) {
+	Limbs result(shift / 32, 0);
+	uint32_t carry = 0;
+	for (uint32_t limb : number) {
+		result.push_back(shift % 32 ? (limb << (shift % 32)) | carry : limb);
+		carry = shift % 32 ? limb >> (32 - shift % 32) : 0;
+	}
+	result.push_back(carry);
+	trim(result);
+	return result;
+}
+
+// a -= b, where a is not less than b
+static void subtract(Limbs& a, const Limbs& b) {
+	int64_t borrow = 0;
+	for (size_t i = 0; i < a.size(); i++) {
+		int64_t difference = static_cast<int64_t>(a[i]) - (i < b.size() ? b[i] : 0) - borrow;
+		borrow = difference < 0;
+		a[i] = static_cast<uint32_t>(difference);
+	}
+	trim(a);
+}
+
+// a = a mod b by subtracting shifted copies of b, each removing at least one leading bit of a;
+// it's only needed when a quotient is too big for the leading bits
+static void reduce(Limbs& a, const Limbs& b) {
+	while (compare(a, b) >= 0) {
+		int shift = bitLength(a) - bitLength(b);
+		Limbs shifted = shiftLeft(b, shift);
+		if (compare(shifted, a) > 0) { shifted = shiftLeft(b, shift - 1); }
+		subtract(a, shifted);
+	}
+}
+
+// Bits [shift, shift + 62) of the number
+static int64_t topBits(const Limbs& number, int shift) {
+	auto limb = [&](size_t i) -> uint64_t { return i < number.size() ? number[i] : 0; };
+	size_t word = shift / 32;
+	int offset = shift % 32;
+	uint64_t bits = (limb(word) | (limb(word + 1) << 32)) >> offset;
+	if (offset > 0) { bits |= limb(word + 2) << (64 - offset); }
+	return static_cast<int64_t>(bits & ((uint64_t(1) << 62) - 1));
+}
+
+// x * a + y * b, which is known to be non-negative and not greater than a
+static Limbs combine(const Limbs& a, const Limbs& b, int64_t x, int64_t y) {
+	Limbs result(a.size(), 0);
+	int64_t carry = 0;
+	for (size_t i = 0; i < a.size(); i++) {
+		int64_t sum = x * a[i] + y * (i < b.size() ? b[i] : 0) + carry;
+		result[i] = static_cast<uint32_t>(sum);
+		carry = sum >> 32;
+	}
+	trim(result);
+	return result;
+}
+
+Limbs toLimbs(const std::string& decimal) {
+	Limbs number;
+	for (size_t start = 0; start < decimal.size(); start += 9) {
+		std::string chunk = decimal.substr(start, 9);
+		uint64_t carry = std::stoul(chunk);
+		uint64_t multiplier = 1;
+		for (size_t i = 0; i < chunk.size(); i++) { multiplier *= 10; }
+		for (uint32_t& limb : number) {
+			carry += limb * multiplier;
+			limb = static_cast<uint32_t>(carry);
+			carry >>= 32;
+		}
+		if (carry > 0) { number.push_back(static_cast<uint32_t>(carry)); }
+	}
+	trim(number);
+	return number;
+}
+
+std::string toDecimal(Limbs number) {
+	trim(number);
+	if (number.empty()) { return "0"; }
+	std::vector<uint32_t> chunks;   // Digits of base 10^9, starting from the lowest one
+	while (!number.empty()) {
+		uint64_t remainder = 0;
+		for (size_t i = number.size(); i-- > 0;) {
+			remainder = (remainder << 32) | number[i];
+			number[i] = static_cast<uint32_t>(remainder / 1000000000);
+			remainder %= 1000000000;
+		}
+		chunks.push_back(static_cast<uint32_t>(remainder));
+		trim(number);
+	}
+	std::string result = std::to_string(chunks.back());
+	for (size_t i = chunks.size() - 1; i-- > 0;) {
+		std::string digits = std::to_string(chunks[i]);
+		result.append(9 - digits.size(), '0');
+		result += digits;
+	}
+	return result;
+}
+
+// Knuth's Algorithm L: quotients of the leading bits are surely the right ones while
+// (a' + A) / (b' + C) and (a' + B) / (b' + D) agree, and the cofactors are kept below 2^30,
+// so that x * a + y * b never overflows 64 bits
+Limbs lehmerGcd(Limbs a, Limbs b) {
+	trim(a);
+	trim(b);
+	if (compare(a, b) < 0) { std::swap(a, b); }
+	const int64_t limit = int64_t(1) << 30;
+	while (b.size() > 2) {
+		int shift = bitLength(a) - 62;
+		int64_t leadingA = topBits(a, shift);
+		int64_t leadingB = topBits(b, shift);
+		int64_t A = 1, B = 0, C = 0, D = 1;
+		while (leadingB + C > 0 && leadingB + D > 0) {
+			int64_t quotient = (leadingA + A) / (leadingB + C);
+			if (quotient != (leadingA + B) / (leadingB + D) || quotient >= limit) { break; }
+			if (quotient * std::max(std::abs(C), std::abs(D)) + std::max(std::abs(A), std::abs(B)) >= limit) { break; }
+			int64_t nextC = A - quotient * C;
+			A = C;
+			C = nextC;
+			int64_t nextD = B - quotient * D;
+			B = D;
+			D = nextD;
+			int64_t nextB = leadingA - quotient * leadingB;
+			leadingA = leadingB;
+			leadingB = nextB;
+		}
+
+		if (B == 0) {
+			// Not even one step was sure, so a single full one is made
+			reduce(a, b);
+			std::swap(a, b);
+		}
+		else {
+			Limbs nextA = combine(a, b, A, B);
+			b = combine(a, b, C, D);
+			a = std::move(nextA);
+		}
+	}
+
+	// Both numbers fit into 64 bits, once a is reduced below b
+	if (b.empty()) { return a; }
+	reduce(a, b);
+	auto toWord = [](const Limbs& number) {
+		return (number.size() > 0 ? uint64_t(number[0]) : 0) | (number.size() > 1 ? uint64_t(number[1]) << 32 : 0);
+	};
+	uint64_t gcd = binaryGcd(toWord(a), toWord(b));
+	Limbs result = { static_cast<uint32_t>(gcd), static_cast<uint32_t>(gcd >> 32) };
+	trim(result);
+	return result;
 }
\ No newline at end of file
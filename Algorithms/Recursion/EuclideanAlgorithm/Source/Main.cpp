@@ -5,9 +5,53 @@
 
 
 #include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
 #include "EuclideanAlgorithm.h"
 
 
+// Runs 'compute' and returns the elapsed milliseconds
+template <typename Compute>
+double milliseconds(Compute compute) {
+	auto start = std::chrono::steady_clock::now();
+	compute();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Compares the 64-bit variants on random pairs and times Lehmer's algorithm on big numbers
+void benchmark() {
+	const size_t count = 1000000;
+	std::mt19937_64 engine(2025);
+	std::vector<uint64_t> a(count), b(count), result(count);
+	for (size_t i = 0; i < count; i++) {
+		a[i] = engine();
+		b[i] = engine();
+	}
+	uint64_t euclideanSum = 0, binarySum = 0, batchSum = 0;
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "GCD of " << count << " random 64-bit pairs (ms):\n";
+	std::cout << " euclidean:\t" << milliseconds([&]() { for (size_t i = 0; i < count; i++) { euclideanSum += euclideanIterative(a[i], b[i]); } }) << "\n";
+	std::cout << " binary:\t" << milliseconds([&]() { for (size_t i = 0; i < count; i++) { binarySum += binaryGcd(a[i], b[i]); } }) << "\n";
+	std::cout << " batch:\t\t" << milliseconds([&]() { binaryGcdBatch(a.data(), b.data(), result.data(), count); }) << "\n";
+	for (size_t i = 0; i < count; i++) { batchSum += result[i]; }
+	std::cout << (euclideanSum == binarySum && binarySum == batchSum ? " (same)\n" : " (different!)\n");
+
+	std::cout << "\nGCD of two random big numbers with Lehmer's algorithm (ms):\n";
+	for (int digits : { 1000, 10000, 50000 }) {
+		std::string first, second;
+		for (int i = 0; i < digits; i++) {
+			first += static_cast<char>('1' + engine() % 9);
+			second += static_cast<char>('1' + engine() % 9);
+		}
+		Limbs left = toLimbs(first), right = toLimbs(second), gcd;
+		std::cout << " " << std::setw(6) << digits << " digits:\t" << milliseconds([&]() { gcd = lehmerGcd(left, right); }) << "\n";
+	}
+}
+
 int main() {
 	// Greet
 	std::cout << "\tWelcome to the 'Euclidean Algorithm (Recursive)' console application!\n";
@@ -22,6 +66,29 @@ int main() {
 
 	// Compute and display the result
 	std::cout << "The GCD of " << a << " and " << b << " is: \t\t" << euclidean(a, b) << std::endl;
+	std::cout << " with the binary algorithm: \t\t" << binaryGcd(a, b) << std::endl;
+	int64_t x = 0, y = 0;
+	int64_t gcd = extendedEuclidean(a, b, x, y);
+	std::cout << " with Bezout's coefficients: \t\t" << gcd << " = " << a << " * (" << x << ") + " << b << " * (" << y << ")" << std::endl;
+	if (b > 1) {
+		uint64_t inverse = modularInverse(a, b);
+		if (inverse != 0) { std::cout << "The inverse of a modulo b is: \t\t" << inverse << std::endl; }
+		else { std::cout << "There is no inverse of a modulo b" << std::endl; }
+	}
+
+	// Compute the GCD of big numbers
+	std::string first, second;
+	std::cout << "\nEnter the first big number: \t\t";
+	std::cin >> first;
+	std::cout << "Enter the second big number: \t\t";
+	std::cin >> second;
+	std::cout << "The GCD of them is: \t\t\t" << toDecimal(lehmerGcd(toLimbs(first), toLimbs(second))) << "\n\n";
+
+	// Compare the variants
+	std::cout << "Run the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) { benchmark(); }
 
 	// Exit
 	std::cout << "\nThanks for using this program! Have a great day!\n";
@@ -8,7 +8,52 @@
 #define FACTORIAL_H
 
 
+#include <cstdint>
+#include <vector>
+#include "BigNumber.h"   // From the Fibonacci folder
+
+
 int factorial(int n);
 
 
+// -----------
+// Big Numbers
+// -----------
+
+// Multiplies the numbers one by one, so each product grows the result by a single limb: O(n^2)
+BigNumber factorialIterative(int n);
+
+// Multiplies the halves of the range recursively, so the products have similar lengths
+// and Karatsuba speeds them up
+BigNumber factorialSplitting(int n);
+
+// n! = ((n/2)!)^2 * swing(n), where the swing is built from primes with known exponents,
+// so there are much fewer and more balanced products
+BigNumber factorialPrimeSwing(int n);
+
+// Exact n! / (k! * (n - k)!) from the exponents of primes in it, without any division
+BigNumber binomial(int n, int k);
+
+
+// ---------------
+// Modular Results
+// ---------------
+
+// Tables of n! and 1/n! modulo a prime for every n up to the limit, so that any factorial
+// or binomial coefficient below it is answered with at most three lookups
+class ModularFactorials {
+private:
+	uint32_t modulus;
+	std::vector<uint32_t> factorials;
+	std::vector<uint32_t> inverseFactorials;
+
+public:
+	ModularFactorials(int limit, uint32_t primeModulus = 1000000007);   // Note: requires limit < primeModulus
+
+	uint32_t factorial(int n) const;
+	uint32_t inverseFactorial(int n) const;
+	uint32_t binomial(int n, int k) const;
+};
+
+
 #endif // FACTORIAL_H
\ No newline at end of file
@@ -5,9 +5,122 @@
 
 
 #include "Factorial.h"
+#include <limits>
 
 
 int factorial(int n) {
 	if (n == 0 || n == 1) { return 1; }
 	return n * factorial(n - 1);
+}
+
+
+// -----------
+// Big Numbers
+// -----------
+
+// Sieve of Eratosthenes
+static std::vector<int> primesUpTo(int n) {
+	std::vector<int> primes;
+	std::vector<bool> composite(n + 1, false);
+	for (int i = 2; i <= n; i++) {
+		if (composite[i]) { continue; }
+		primes.push_back(i);
+		for (long long j = static_cast<long long>(i) * i; j <= n; j += i) { composite[j] = true; }
+	}
+	return primes;
+}
+
+// Packs small factors into 64-bit ones, so the leaves of the splitting are not tiny numbers
+static void appendFactor(std::vector<uint64_t>& factors, uint64_t factor) {
+	if (!factors.empty() && factors.back() <= std::numeric_limits<uint64_t>::max() / factor) { factors.back() *= factor; }
+	else { factors.push_back(factor); }
+}
+
+// Product of factors in [first, last), split in halves so that every product joins similar lengths
+static BigNumber product(const std::vector<uint64_t>& factors, size_t first, size_t last) {
+	if (first == last) { return 1; }
+	if (last - first == 1) { return factors[first]; }
+	size_t middle = first + (last - first) / 2;
+	return product(factors, first, middle) * product(factors, middle, last);
+}
+
+BigNumber factorialIterative(int n) {
+	BigNumber result = 1;
+	for (int i = 2; i <= n; i++) { result = result * BigNumber(i); }
+	return result;
+}
+
+BigNumber factorialSplitting(int n) {
+	std::vector<uint64_t> factors;
+	for (int i = 2; i <= n; i++) { appendFactor(factors, i); }
+	return product(factors, 0, factors.size());
+}
+
+// swing(n) = n! / ((n/2)!)^2, where prime p has exponent equal to the number of odd values among n/p, n/p^2, ...
+static BigNumber swing(int n, const std::vector<int>& primes) {
+	std::vector<uint64_t> factors;
+	for (int p : primes) {
+		if (p > n) { break; }
+		for (int q = n / p; q > 0; q /= p) {
+			if (q & 1) { appendFactor(factors, p); }
+		}
+	}
+	return product(factors, 0, factors.size());
+}
+
+static BigNumber factorialPrimeSwing(int n, const std::vector<int>& primes) {
+	if (n < 2) { return 1; }
+	BigNumber half = factorialPrimeSwing(n / 2, primes);
+	return half * half * swing(n, primes);
+}
+
+BigNumber factorialPrimeSwing(int n) {
+	return factorialPrimeSwing(n, primesUpTo(n));
+}
+
+// Exponent of prime p is the number of carries when adding k and n - k in base p (Kummer's theorem),
+// computed here as the difference of Legendre's sums for n, k and n - k
+BigNumber binomial(int n, int k) {
+	if (k < 0 || k > n) { return 0; }
+	std::vector<uint64_t> factors;
+	for (int p : primesUpTo(n)) {
+		for (long long q = p; q <= n; q *= p) {
+			if (n / q - k / q - (n - k) / q == 1) { appendFactor(factors, p); }
+		}
+	}
+	return product(factors, 0, factors.size());
+}
+
+
+// ---------------
+// Modular Results
+// ---------------
+
+// base^exponent modulo 'modulus' by repeated squaring
+static uint32_t powerModulo(uint64_t base, uint32_t exponent, uint32_t modulus) {
+	uint64_t result = 1;
+	for (base %= modulus; exponent > 0; exponent >>= 1) {
+		if (exponent & 1) { result = result * base % modulus; }
+		base = base * base % modulus;
+	}
+	return static_cast<uint32_t>(result);
+}
+
+// The only inversion is the one of limit! (by Fermat's little theorem), the others come from 1/(i-1)! = i * 1/i!
+ModularFactorials::ModularFactorials(int limit, uint32_t primeModulus)
+	: modulus(primeModulus), factorials(limit + 1), inverseFactorials(limit + 1) {
+	factorials[0] = 1 % modulus;
+	for (int i = 1; i <= limit; i++) { factorials[i] = static_cast<uint32_t>(static_cast<uint64_t>(factorials[i - 1]) * i % modulus); }
+	inverseFactorials[limit] = powerModulo(factorials[limit], modulus - 2, modulus);
+	for (int i = limit; i > 0; i--) { inverseFactorials[i - 1] = static_cast<uint32_t>(static_cast<uint64_t>(inverseFactorials[i]) * i % modulus); }
+}
+
+uint32_t ModularFactorials::factorial(int n) const { return factorials[n]; }
+
+uint32_t ModularFactorials::inverseFactorial(int n) const { return inverseFactorials[n]; }
+
+uint32_t ModularFactorials::binomial(int n, int k) const {
+	if (k < 0 || k > n) { return 0; }
+	uint64_t result = static_cast<uint64_t>(factorials[n]) * inverseFactorials[k] % modulus;
+	return static_cast<uint32_t>(result * inverseFactorials[n - k] % modulus);
 }
\ No newline at end of file
@@ -5,9 +5,45 @@
 
 
 #include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
 #include "Factorial.h"
+#include "BigNumber.h"   // From the Fibonacci folder
 
 
+// Runs 'compute' and returns the elapsed milliseconds
+template <typename Compute>
+double milliseconds(Compute compute) {
+	auto start = std::chrono::steady_clock::now();
+	compute();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Prints the length of a big number and its first and last digits
+void display(const BigNumber& value) {
+	std::string digits = value.toString();
+	std::cout << value.digitsCount() << " digits:\n ";
+	if (digits.size() <= 40) { std::cout << digits << "\n"; }
+	else { std::cout << digits.substr(0, 20) << "..." << digits.substr(digits.size() - 20) << "\n"; }
+}
+
+// Compares the big number variants for growing numbers
+void benchmark() {
+	std::cout << std::setw(10) << "Number" << std::setw(14) << "Iterative" << std::setw(14) << "Splitting"
+		<< std::setw(14) << "Prime Swing" << "   (ms)" << std::endl;
+	for (int n : { 10000, 50000, 100000, 500000 }) {
+		BigNumber iterative, splitting, primeSwing;
+		std::cout << std::setw(10) << n << std::fixed << std::setprecision(2);
+		if (n <= 50000) { std::cout << std::setw(14) << milliseconds([&]() { iterative = factorialIterative(n); }); }
+		else { std::cout << std::setw(14) << "-"; }
+		std::cout << std::setw(14) << milliseconds([&]() { splitting = factorialSplitting(n); });
+		std::cout << std::setw(14) << milliseconds([&]() { primeSwing = factorialPrimeSwing(n); });
+		std::cout << (splitting == primeSwing && (n > 50000 || iterative == primeSwing) ? "   (same)" : "   (different!)") << std::endl;
+	}
+}
+
 int main() {
 	// Greet
 	std::cout << "\tWelcome to the 'Factorial' console application!\n";
@@ -19,7 +55,36 @@ int main() {
 
 	// Compute and display the result
 	std::cout << "The factorial of it:\t\t" << factorial(n) << "\n";
-	
+
+	// Compute exact values far beyond 'int'
+	std::cout << "\nEnter a big number (e.g. 100000):\t";
+	int big = 0;
+	std::cin >> big;
+	BigNumber value;
+	double time = milliseconds([&]() { value = factorialPrimeSwing(big); });
+	std::cout << "The factorial of it, computed in " << std::fixed << std::setprecision(2) << time << " ms, has ";
+	display(value);
+
+	std::cout << "\nEnter n and k for the binomial coefficient (e.g. 100000 50000):\t";
+	int k = 0;
+	std::cin >> big >> k;
+	std::cout << "The binomial coefficient has ";
+	display(binomial(big, k));
+
+	// Answer repeated queries modulo a prime from the tables
+	const int limit = 1000000;
+	ModularFactorials tables(limit);
+	std::cout << "\nEnter n and k up to " << limit << " for the results modulo 10^9 + 7:\t";
+	std::cin >> big >> k;
+	std::cout << "The factorial of n:\t\t" << tables.factorial(big) << "\n";
+	std::cout << "The binomial coefficient:\t" << tables.binomial(big, k) << "\n\n";
+
+	// Compare the variants
+	std::cout << "Run the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) { benchmark(); }
+
 	// Exit
 	std::cout << "\nThanks for using this program! Have a great day!\n";
 	std::cout << "Press <Enter> to exit...";
@@ -0,0 +1,46 @@
+// Title:   Header file for Big Number
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef BIG_NUMBER_H
+#define BIG_NUMBER_H
+
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+// Non-negative integer of any size, stored as digits of base 10^9 starting from the lowest one,
+// so that printing it in decimal needs no conversion; only the operations Fibonacci and Factorial need
+class BigNumber {
+private:
+	static const uint32_t base = 1000000000;
+	static const size_t karatsubaThreshold = 32;   // Smaller products are computed directly
+
+	std::vector<uint32_t> limbs;   // No leading zero limbs, empty for zero
+
+	void trim();
+	static void addAt(std::vector<uint32_t>& target, const std::vector<uint32_t>& value, size_t shift);
+	static void subtract(std::vector<uint32_t>& target, const std::vector<uint32_t>& value);
+	static std::vector<uint32_t> multiply(const uint32_t* a, size_t sizeA, const uint32_t* b, size_t sizeB);
+
+public:
+	BigNumber(uint64_t value = 0);
+
+	BigNumber& operator+=(const BigNumber& rhs);
+	BigNumber& operator-=(const BigNumber& rhs);   // Note: requires rhs not greater than *this
+	friend BigNumber operator+(BigNumber lhs, const BigNumber& rhs);
+	friend BigNumber operator-(BigNumber lhs, const BigNumber& rhs);
+	friend BigNumber operator*(const BigNumber& lhs, const BigNumber& rhs);
+	friend bool operator==(const BigNumber& lhs, const BigNumber& rhs);
+
+	std::string toString() const;
+	size_t digitsCount() const;
+};
+
+
+#endif // BIG_NUMBER_H
@@ -8,7 +8,97 @@
 #define FIBONACCI_H
 
 
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <utility>
+
+
 int fibonacci(int n);
 
 
+// ---------------
+// Faster Variants
+// ---------------
+
+// Every value, which fits into 64 bits (F(93) is the last one), computed at compile time
+constexpr int fibonacciTableSize = 94;
+
+constexpr std::array<uint64_t, fibonacciTableSize> makeFibonacciTable() {
+	std::array<uint64_t, fibonacciTableSize> table{};
+	table[1] = 1;
+	for (int i = 2; i < fibonacciTableSize; i++) { table[i] = table[i - 1] + table[i - 2]; }
+	return table;
+}
+
+constexpr std::array<uint64_t, fibonacciTableSize> fibonacciTable = makeFibonacciTable();
+static_assert(fibonacciTable[93] == 12200160415121876738ull, "F(93) must be the largest 64-bit value");
+
+// Same recursion, which stores every computed value, so each one is computed once: O(n)
+uint64_t fibonacciMemoized(int n);
+
+// First 'count' values, each one from the two stored before it
+std::vector<uint64_t> fibonacciSequence(int count);
+
+// The functions below work both with uint64_t (exact up to F(93)) and with BigNumber
+
+// Keeps only the last two values: O(n) additions
+template <typename Number = uint64_t>
+Number fibonacciIterative(int n) {
+	Number current = 0;   // F(i)
+	Number next = 1;      // F(i + 1)
+	for (int i = 0; i < n; i++) {
+		current += next;
+		std::swap(current, next);
+	}
+	return current;
+}
+
+// 2x2 matrix [[a, b], [c, d]]
+template <typename Number>
+struct FibonacciMatrix {
+	Number a, b, c, d;
+};
+
+template <typename Number>
+FibonacciMatrix<Number> multiply(const FibonacciMatrix<Number>& x, const FibonacciMatrix<Number>& y) {
+	return { x.a * y.a + x.b * y.c, x.a * y.b + x.b * y.d,
+	         x.c * y.a + x.d * y.c, x.c * y.b + x.d * y.d };
+}
+
+// [[1, 1], [1, 0]]^n = [[F(n + 1), F(n)], [F(n), F(n - 1)]], raised by squaring: O(log n) products
+template <typename Number = uint64_t>
+Number fibonacciMatrix(int n) {
+	FibonacciMatrix<Number> result = { 1, 0, 0, 1 };
+	FibonacciMatrix<Number> power = { 1, 1, 1, 0 };
+	while (n > 0) {
+		if (n & 1) { result = multiply(result, power); }
+		n >>= 1;
+		if (n > 0) { power = multiply(power, power); }
+	}
+	return result.b;
+}
+
+// From F(k) and F(k + 1): F(2k) = F(k) * (2F(k + 1) - F(k)) and F(2k + 1) = F(k)^2 + F(k + 1)^2,
+// so walking the bits of n from the highest one takes O(log n) steps of three products
+template <typename Number = uint64_t>
+Number fibonacciFastDoubling(int n) {
+	Number current = 0;   // F(k)
+	Number next = 1;      // F(k + 1)
+	for (int bit = 30; bit >= 0; bit--) {
+		Number doubled = current * (next + next - current);
+		Number doubledNext = current * current + next * next;
+		if ((n >> bit) & 1) {
+			next = doubled + doubledNext;
+			current = std::move(doubledNext);
+		}
+		else {
+			current = std::move(doubled);
+			next = std::move(doubledNext);
+		}
+	}
+	return current;
+}
+
+
 #endif // FIBONACCI_H
\ No newline at end of file
@@ -0,0 +1,156 @@
+// Title:   Source file for Big Number
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "BigNumber.h"
+#include <algorithm>
+
+
+BigNumber::BigNumber(uint64_t value) {
+	for (; value > 0; value /= base) { limbs.push_back(static_cast<uint32_t>(value % base)); }
+}
+
+void BigNumber::trim() {
+	while (!limbs.empty() && limbs.back() == 0) { limbs.pop_back(); }
+}
+
+// target += value * base^shift
+void BigNumber::addAt(std::vector<uint32_t>& target, const std::vector<uint32_t>& value, size_t shift) {
+	if (target.size() < shift + value.size() + 1) { target.resize(shift + value.size() + 1, 0); }
+	uint32_t carry = 0;
+	size_t i = 0;
+	for (; i < value.size(); i++) {
+		uint32_t sum = target[shift + i] + value[i] + carry;
+		carry = sum >= base;
+		target[shift + i] = carry ? sum - base : sum;
+	}
+	for (; carry; i++) {
+		if (shift + i == target.size()) { target.push_back(0); }
+		uint32_t sum = target[shift + i] + carry;
+		carry = sum >= base;
+		target[shift + i] = carry ? sum - base : sum;
+	}
+}
+
+// target -= value, where target is not less than value
+void BigNumber::subtract(std::vector<uint32_t>& target, const std::vector<uint32_t>& value) {
+	uint32_t borrow = 0;
+	size_t i = 0;
+	for (; i < value.size(); i++) {
+		uint32_t subtrahend = value[i] + borrow;
+		borrow = target[i] < subtrahend;
+		target[i] = borrow ? target[i] + base - subtrahend : target[i] - subtrahend;
+	}
+	for (; borrow; i++) {
+		borrow = target[i] == 0;
+		target[i] = borrow ? base - 1 : target[i] - 1;
+	}
+}
+
+// Karatsuba: with a = a1 * B + a0 and b = b1 * B + b0 the product needs only three smaller ones,
+// a0 * b0, a1 * b1 and (a0 + a1) * (b0 + b1), as the middle part is the last one minus the others;
+// small or very unequal operands are multiplied directly (or split only the longer one)
+std::vector<uint32_t> BigNumber::multiply(const uint32_t* a, size_t sizeA, const uint32_t* b, size_t sizeB) {
+	if (sizeA < sizeB) {
+		std::swap(a, b);
+		std::swap(sizeA, sizeB);
+	}
+	std::vector<uint32_t> result(sizeA + sizeB, 0);
+	if (sizeB == 0) { return result; }
+
+	// Products are below 10^18, so 16 rows of them are summed in 64 bits before the carries
+	// have to be moved on, which keeps divisions out of the inner loop
+	if (sizeB < karatsubaThreshold) {
+		std::vector<uint64_t> sums(sizeA + sizeB, 0);
+		for (size_t i = 0; i < sizeB; i++) {
+			for (size_t j = 0; j < sizeA; j++) { sums[i + j] += static_cast<uint64_t>(b[i]) * a[j]; }
+			if (i % 16 == 15 || i + 1 == sizeB) {
+				uint64_t carry = 0;
+				for (uint64_t& sum : sums) {
+					sum += carry;
+					carry = sum / base;
+					sum %= base;
+				}
+			}
+		}
+		for (size_t i = 0; i < sums.size(); i++) { result[i] = static_cast<uint32_t>(sums[i]); }
+		return result;
+	}
+
+	size_t half = (sizeA + 1) / 2;
+	if (sizeB <= half) {
+		addAt(result, multiply(a, half, b, sizeB), 0);
+		addAt(result, multiply(a + half, sizeA - half, b, sizeB), half);
+		result.resize(sizeA + sizeB);
+		return result;
+	}
+
+	std::vector<uint32_t> low = multiply(a, half, b, half);
+	std::vector<uint32_t> high = multiply(a + half, sizeA - half, b + half, sizeB - half);
+	std::vector<uint32_t> sumA(a, a + half);
+	std::vector<uint32_t> sumB(b, b + half);
+	addAt(sumA, std::vector<uint32_t>(a + half, a + sizeA), 0);
+	addAt(sumB, std::vector<uint32_t>(b + half, b + sizeB), 0);
+	std::vector<uint32_t> middle = multiply(sumA.data(), sumA.size(), sumB.data(), sumB.size());
+	subtract(middle, low);
+	subtract(middle, high);
+
+	addAt(result, low, 0);
+	addAt(result, middle, half);
+	addAt(result, high, 2 * half);
+	result.resize(sizeA + sizeB);
+	return result;
+}
+
+
+// ---------
+// Operators
+// ---------
+
+BigNumber& BigNumber::operator+=(const BigNumber& rhs) {
+	addAt(limbs, rhs.limbs, 0);
+	trim();
+	return *this;
+}
+
+BigNumber& BigNumber::operator-=(const BigNumber& rhs) {
+	subtract(limbs, rhs.limbs);
+	trim();
+	return *this;
+}
+
+BigNumber operator+(BigNumber lhs, const BigNumber& rhs) { return lhs += rhs; }
+
+BigNumber operator-(BigNumber lhs, const BigNumber& rhs) { return lhs -= rhs; }
+
+BigNumber operator*(const BigNumber& lhs, const BigNumber& rhs) {
+	BigNumber product;
+	product.limbs = BigNumber::multiply(lhs.limbs.data(), lhs.limbs.size(), rhs.limbs.data(), rhs.limbs.size());
+	product.trim();
+	return product;
+}
+
+bool operator==(const BigNumber& lhs, const BigNumber& rhs) { return lhs.limbs == rhs.limbs; }
+
+
+// ------
+// Output
+// ------
+
+std::string BigNumber::toString() const {
+	if (limbs.empty()) { return "0"; }
+	std::string result = std::to_string(limbs.back());
+	for (size_t i = limbs.size() - 1; i-- > 0;) {
+		std::string digits = std::to_string(limbs[i]);
+		result.append(9 - digits.size(), '0');
+		result += digits;
+	}
+	return result;
+}
+
+size_t BigNumber::digitsCount() const {
+	if (limbs.empty()) { return 1; }
+	return 9 * (limbs.size() - 1) + std::to_string(limbs.back()).size();
+}
@@ -10,4 +10,27 @@
 int fibonacci(int n) {
 	if (n <= 1) { return n; }
 	return fibonacci(n - 1) + fibonacci(n - 2);
+}
+
+
+// ---------------
+// Faster Variants
+// ---------------
+
+// Zero marks values not computed yet, as only F(0) is zero and it is a base case
+static uint64_t fibonacciMemoized(int n, std::vector<uint64_t>& memo) {
+	if (n <= 1) { return n; }
+	if (memo[n] == 0) { memo[n] = fibonacciMemoized(n - 1, memo) + fibonacciMemoized(n - 2, memo); }
+	return memo[n];
+}
+
+uint64_t fibonacciMemoized(int n) {
+	std::vector<uint64_t> memo(n + 1, 0);
+	return fibonacciMemoized(n, memo);
+}
+
+std::vector<uint64_t> fibonacciSequence(int count) {
+	std::vector<uint64_t> sequence(count);
+	for (int i = 0; i < count; i++) { sequence[i] = i <= 1 ? i : sequence[i - 1] + sequence[i - 2]; }
+	return sequence;
 }
\ No newline at end of file
@@ -5,20 +5,74 @@
 
 
 #include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
 #include "Fibonacci.h"
+#include "BigNumber.h"
 
 
+// Runs 'compute' and returns the elapsed milliseconds
+template <typename Compute>
+double milliseconds(Compute compute) {
+	auto start = std::chrono::steady_clock::now();
+	compute();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Compares the variants with big numbers for growing indices
+void benchmark() {
+	std::cout << std::setw(10) << "Index" << std::setw(14) << "Iterative" << std::setw(14) << "Matrix"
+		<< std::setw(16) << "Fast Doubling" << "   (ms)" << std::endl;
+	for (int n : { 10000, 100000, 1000000 }) {
+		BigNumber iterative, matrix, doubling;
+		std::cout << std::setw(10) << n << std::fixed << std::setprecision(2);
+		if (n <= 100000) { std::cout << std::setw(14) << milliseconds([&]() { iterative = fibonacciIterative<BigNumber>(n); }); }
+		else { std::cout << std::setw(14) << "-"; }
+		std::cout << std::setw(14) << milliseconds([&]() { matrix = fibonacciMatrix<BigNumber>(n); });
+		std::cout << std::setw(16) << milliseconds([&]() { doubling = fibonacciFastDoubling<BigNumber>(n); });
+		std::cout << (matrix == doubling && (n > 100000 || iterative == doubling) ? "   (same)" : "   (different!)") << std::endl;
+	}
+}
+
 int main() {
 	// Greet
 	std::cout << "\tWelcome to the 'Fibonacci Sequence' console application!\n";
 
 	// Prompt the user for input
-	std::cout << "\nEnter the sequence index (0-45): "; 
+	std::cout << "\nEnter the sequence index (0-45): ";
 	int n = 0;
 	std::cin >> n;
 
 	// Compute and display the result
 	std::cout << "The Fibonacci value for it:\t " << fibonacci(n) << "\n";
+	std::cout << " memoized:\t\t " << fibonacciMemoized(n) << "\n";
+	std::cout << " iterative:\t\t " << fibonacciIterative(n) << "\n";
+	std::cout << " compile-time table:\t " << fibonacciTable[n] << "\n";
+	std::cout << " matrix power:\t\t " << fibonacciMatrix(n) << "\n";
+	std::cout << " fast doubling:\t\t " << fibonacciFastDoubling(n) << "\n";
+	std::cout << " first values:\t\t ";
+	for (uint64_t value : fibonacciSequence(n + 1 < 10 ? n + 1 : 10)) { std::cout << value << " "; }
+	std::cout << "\n";
+
+	// Compute values far beyond 64 bits
+	std::cout << "\nEnter a big sequence index (e.g. 1000000): ";
+	int big = 0;
+	std::cin >> big;
+	BigNumber value;
+	double time = milliseconds([&]() { value = fibonacciFastDoubling<BigNumber>(big); });
+	std::string digits = value.toString();
+	std::cout << "The Fibonacci value for it has " << value.digitsCount() << " digits, computed in "
+		<< std::fixed << std::setprecision(2) << time << " ms:\n ";
+	if (digits.size() <= 40) { std::cout << digits << "\n\n"; }
+	else { std::cout << digits.substr(0, 20) << "..." << digits.substr(digits.size() - 20) << "\n\n"; }
+
+	// Compare the variants
+	std::cout << "Run the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) { benchmark(); }
 
 	// Exit
 	std::cout << "\nThanks for using this program! Have a great day!\n";
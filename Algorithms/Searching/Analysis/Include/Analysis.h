@@ -0,0 +1,47 @@
+// Title:   Header file for Analysis of Searching Algorithms
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef ANALYSIS_H
+#define ANALYSIS_H
+
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+
+// Averages of one search over the same queries
+struct Measurement {
+	double probes;        // Elements read per search
+	double nanoseconds;   // Time per search
+	long long checksum;   // Sum of the found positions, equal for all correct searches
+};
+
+// Targets are present elements taken from the first 'range' positions of 'arr' (or from the
+// whole array if it is smaller), as some searches depend on the position of the answer
+std::vector<int> createQueries(const std::vector<int>& arr, int count, int range, std::mt19937& gen);
+
+// Runs 'search(at, size, target)' for all queries twice: with an accessor that counts the
+// elements read, and with a plain one, which is timed
+template <typename Search>
+Measurement measure(Search search, const std::vector<int>& arr, const std::vector<int>& queries) {
+	const int* data = arr.data();
+	int size = static_cast<int>(arr.size());
+
+	long long probes = 0;
+	for (int q : queries) { search([&probes, data](int i) { probes++; return data[i]; }, size, q); }
+
+	long long checksum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int q : queries) { checksum += search([data](int i) { return data[i]; }, size, q); }
+	auto end = std::chrono::steady_clock::now();
+
+	double count = static_cast<double>(queries.size());
+	return { probes / count, std::chrono::duration<double, std::nano>(end - start).count() / count, checksum };
+}
+
+
+#endif // ANALYSIS_H
@@ -0,0 +1,16 @@
+// Title:   Source file for Analysis of Searching Algorithms
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include "Analysis.h"
+
+
+std::vector<int> createQueries(const std::vector<int>& arr, int count, int range, std::mt19937& gen) {
+	int limit = std::min(static_cast<int>(arr.size()), range);
+	std::vector<int> queries(count);
+	for (int& q : queries) { q = arr[gen() % limit]; }
+	return queries;
+}
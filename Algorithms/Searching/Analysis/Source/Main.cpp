@@ -0,0 +1,86 @@
+// Title:   Analysis of Searching Algorithms
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include "Analysis.h"
+#include "BinarySearch.h"
+#include "ExponentialSearch.h"
+#include "JumpSearch.h"
+#include "FibonacciSearch.h"
+#include "LinearSearch.h"
+
+
+// Compares every search on sorted arrays of 2^10 up to 2^maxPower elements, with targets
+// taken from the first 'range' positions; linear search is skipped, when it would read
+// more than a million elements per search
+void compare(int maxPower, int range) {
+	const int queriesCount = 1 << 12;
+	const int linearLimit = 1 << 20;
+	const char* names[] = { "Binary", "Exp.", "Jump", "Fib.", "Linear" };
+	std::mt19937 gen(42);
+
+	std::cout << std::setw(10) << "Size" << "   Probes:";
+	for (const char* name : names) { std::cout << std::setw(10) << name; }
+	std::cout << "     Time:";
+	for (const char* name : names) { std::cout << std::setw(10) << name; }
+	std::cout << "   (per search, ns)\n";
+
+	for (int p = 10; p <= maxPower; p += 2) {
+		int size = 1 << p;
+		std::vector<int> arr(size);
+		for (int i = 0; i < size; i++) { arr[i] = 2 * i; }
+		std::vector<int> queries = createQueries(arr, queriesCount, range, gen);
+
+		int count = (std::min(size, range) <= linearLimit) ? 5 : 4;
+		Measurement results[5] = {
+			measure([](auto at, int n, int t) { return binaryLowerBound(at, n, t); }, arr, queries),
+			measure([](auto at, int n, int t) { return exponentialLowerBound(at, n, t); }, arr, queries),
+			measure([](auto at, int n, int t) { return jumpLowerBound(at, n, t); }, arr, queries),
+			measure([](auto at, int n, int t) { return fibonacciLowerBound(at, n, t); }, arr, queries),
+		};
+		if (count == 5) { results[4] = measure([](auto at, int n, int t) { return linearLowerBound(at, n, t); }, arr, queries); }
+
+		bool same = true;
+		std::cout << std::setw(10) << size << std::setw(10) << "" << std::fixed << std::setprecision(1);
+		for (int s = 0; s < 5; s++) {
+			if (s < count) { std::cout << std::setw(10) << results[s].probes; } else { std::cout << std::setw(10) << "-"; }
+			same = same && (s >= count || results[s].checksum == results[0].checksum);
+		}
+		std::cout << std::setw(10) << "";
+		for (int s = 0; s < 5; s++) {
+			if (s < count) { std::cout << std::setw(10) << results[s].nanoseconds; } else { std::cout << std::setw(10) << "-"; }
+		}
+		std::cout << (same ? "" : "   (mismatch!)") << std::endl;
+	}
+}
+
+int main() {
+	// Greet
+	std::cout << "\tWelcome to the 'Analysis' console application!\n";
+
+	// Prompt the user for input
+	std::cout << "\nSpecify the largest size as a power of two (10-26): ";
+	int maxPower = 0;
+	std::cin >> maxPower;
+	maxPower = std::max(10, std::min(maxPower, 26));
+
+	// Compare the searches, where the answer can be anywhere and where it is near the start
+	std::cout << "\nTargets anywhere in the array:\n";
+	compare(maxPower, 1 << 30);
+	std::cout << "\nTargets within the first 1024 elements:\n";
+	compare(maxPower, 1024);
+
+	// Exit
+	std::cout << "\nThanks for using this program! Have a great day!\n";
+	std::cout << "Press <Enter> to exit...";
+	std::cin.ignore();
+	std::cin.get();
+	return 0;
+}
\ No newline at end of file
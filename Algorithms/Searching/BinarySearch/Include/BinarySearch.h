@@ -10,5 +10,31 @@
 
 int binarySearch(int arr[], int left, int right, int target);
 
+// Cache-friendly variants, all of them return the lower bound (first element >= target)
+int branchlessLowerBound(const int arr[], int size, int target);
+int prefetchLowerBound(const int arr[], int size, int target);
+void buildEytzinger(const int arr[], int size, int eytz[]);
+int eytzingerLowerBound(const int eytz[], int size, int target);
+int simdLowerBound(const int arr[], int size, int target);
+void batchedLowerBound(const int arr[], int size, const int targets[], int count, int results[]);
 
-#endif // BINARYSEARCH_H
\ No newline at end of file
+
+// Lower bound within any sorted source, where 'at(i)' returns its i-th element, so it can
+// be compared with jump, exponential and Fibonacci searches by the elements each of them reads
+template <typename Source>
+int binaryLowerBound(Source at, int size, int target) {
+	int left = 0;
+	int right = size;
+	while (left < right) {
+		int mid = left + (right - left) / 2;
+		if (at(mid) < target) {
+			left = mid + 1;
+		} else {
+			right = mid;
+		}
+	}
+	return left;
+}
+
+
+#endif // BINARYSEARCH_H
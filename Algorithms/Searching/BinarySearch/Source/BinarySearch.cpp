@@ -4,8 +4,22 @@
 // ----------------------------------------------------------------------------
 
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include "BinarySearch.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#define PREFETCH(addr) _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
+#else
+#define PREFETCH(addr) __builtin_prefetch(addr)
+#endif
+
 
 int binarySearch(int arr[], int left, int right, int target) {
 	while (left <= right) {
@@ -23,4 +37,151 @@ int binarySearch(int arr[], int left, int right, int target) {
 	}
 
 	return -1;
-}
\ No newline at end of file
+}
+
+// Shrinks the interval by its lower half on every step, the comparison result is
+// used as a multiplier instead of a branch, so there are no mispredictions to pay for
+int branchlessLowerBound(const int arr[], int size, int target) {
+	if (size <= 0) { return 0; }
+
+	const int* base = arr;
+	int len = size;
+	while (len > 1) {
+		int half = len / 2;
+		base += (base[half - 1] < target) * half;
+		len -= half;
+	}
+
+	return static_cast<int>(base - arr) + (*base < target);
+}
+
+// Same as branchless one, but requests both possible middles of the next step in
+// advance, so the memory latency overlaps with the current comparison
+int prefetchLowerBound(const int arr[], int size, int target) {
+	if (size <= 0) { return 0; }
+
+	const int* base = arr;
+	int len = size;
+	while (len > 1) {
+		int half = len / 2;
+		int next = (len - half) / 2;
+		PREFETCH(base + next - 1);
+		PREFETCH(base + half + next - 1);
+		base += (base[half - 1] < target) * half;
+		len -= half;
+	}
+
+	return static_cast<int>(base - arr) + (*base < target);
+}
+
+// Fills the 1-based implicit tree (children of k are 2k and 2k+1) by in-order walk
+static int fillEytzinger(const int arr[], int size, int eytz[], int i, int k) {
+	if (k <= size) {
+		i = fillEytzinger(arr, size, eytz, i, 2 * k);
+		eytz[k] = arr[i++];
+		i = fillEytzinger(arr, size, eytz, i, 2 * k + 1);
+	}
+	return i;
+}
+
+// Rearranges sorted array into BFS order, 'eytz' must hold 'size + 1' elements (index 0 is unused)
+void buildEytzinger(const int arr[], int size, int eytz[]) {
+	fillEytzinger(arr, size, eytz, 0, 1);
+}
+
+static int trailingOnes(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(~x);
+#else
+	int count = 0;
+	for (; x & 1; x >>= 1) { count++; }
+	return count;
+#endif
+}
+
+// Descends the implicit tree, 16 ints (one cache line) of descendants 4 levels below
+// are prefetched on each step; returns position in 'eytz' or 0 if all elements are less;
+// 'k' is 64-bit, as for 2^30 and more elements it reaches 2^31 - 1 and the shift below would be 32
+int eytzingerLowerBound(const int eytz[], int size, int target) {
+	uint64_t k = 1;
+	while (k <= static_cast<uint64_t>(size)) {
+		PREFETCH(eytz + static_cast<size_t>(k) * 16);
+		k = 2 * k + (eytz[k] < target);
+	}
+
+	// Undo the right turns taken after the last left one
+	k >>= trailingOnes(k) + 1;
+	return static_cast<int>(k);
+}
+
+// Last levels of the search are done over a contiguous window of this many elements
+#if defined(__AVX2__)
+static const int simdWindow = 64;
+#else
+static const int simdWindow = 8;
+#endif
+
+// Counts elements less than target, 8 lanes at a time when AVX2 is available
+static int countLess(const int* p, int len, int target) {
+	int count = 0;
+	int i = 0;
+#if defined(__AVX2__)
+	__m256i t = _mm256_set1_epi32(target);
+	__m256i acc = _mm256_setzero_si256();
+	for (; i + 8 <= len; i += 8) {
+		__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+		acc = _mm256_sub_epi32(acc, _mm256_cmpgt_epi32(t, v)); // each match is -1
+	}
+	__m128i sum = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+	count = _mm_cvtsi128_si32(sum);
+#endif
+	for (; i < len; i++) { count += (p[i] < target); }
+	return count;
+}
+
+// Halves the interval until it fits into a small window, which is then resolved
+// as a single wide k-ary node: the answer is the number of its elements less than target
+int simdLowerBound(const int arr[], int size, int target) {
+	const int* base = arr;
+	int len = size;
+	while (len > simdWindow) {
+		int half = len / 2;
+		base += (base[half - 1] < target) * half;
+		len -= half;
+	}
+
+	return static_cast<int>(base - arr) + countLess(base, std::max(len, 0), target);
+}
+
+// Runs a group of searches in lockstep: all of them share the same interval length
+// on every level, so while one probe waits for memory the others proceed, and each
+// probe prefetches its next address that will be needed only after the whole group
+void batchedLowerBound(const int arr[], int size, const int targets[], int count, int results[]) {
+	const int group = 16;
+	const int* base[group];
+
+	for (int g = 0; g < count; g += group) {
+		int m = std::min(group, count - g);
+		for (int j = 0; j < m; j++) { base[j] = arr; }
+
+		int len = size;
+		while (len > simdWindow) {
+			int half = len / 2;
+			int next = std::max((len - half) / 2, 1);
+			for (int j = 0; j < m; j++) {
+				base[j] += (base[j][half - 1] < targets[g + j]) * half;
+				PREFETCH(base[j] + next - 1);
+			}
+			len -= half;
+		}
+
+		for (int j = 0; j < m; j++) {
+			for (int k = 0; k < len; k += 16) { PREFETCH(base[j] + k); }
+		}
+		for (int j = 0; j < m; j++) {
+			results[g + j] = static_cast<int>(base[j] - arr) + countLess(base[j], std::max(len, 0), targets[g + j]);
+		}
+	}
+}
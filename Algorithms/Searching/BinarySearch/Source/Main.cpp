@@ -6,6 +6,9 @@
 
 #include <iostream>
 #include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
 #include "BinarySearch.h"
 
 
@@ -23,6 +26,64 @@ void printArray(int arr[], int size) {
 	std::cout << std::endl;
 }
 
+// Measures average nanoseconds per lookup of 'queries' random targets
+template <typename Search>
+double measure(Search search, const std::vector<int>& queries, long long& checksum) {
+	auto start = std::chrono::steady_clock::now();
+	for (int q : queries) { checksum += search(q); }
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count() / queries.size();
+}
+
+// Compares every variant on sorted arrays of 2^10 up to 2^maxPower elements
+void benchmark(int maxPower) {
+	const int queriesCount = 1 << 20;
+	std::mt19937 gen(42);
+
+	std::cout << std::setw(12) << "Size" << std::setw(14) << "binarySearch" << std::setw(14) << "Branchless"
+		<< std::setw(14) << "Prefetch" << std::setw(14) << "Eytzinger" << std::setw(14) << "SIMD"
+		<< std::setw(14) << "Batched" << "   (ns per lookup)\n";
+	for (int p = 10; p <= maxPower; p += 2) {
+		int size = 1 << p;
+		std::vector<int> arr(size);
+		for (int i = 0; i < size; i++) { arr[i] = 2 * i; }
+		std::vector<int> eytz(size + 1);
+		buildEytzinger(arr.data(), size, eytz.data());
+
+		std::uniform_int_distribution<int> dist(0, 2 * (size - 1) + 1);   // 2 * size - 1 overflows for 2^30
+		std::vector<int> queries(queriesCount);
+		for (int& q : queries) { q = dist(gen); }
+
+		long long sums[6] = {};
+		double classic = measure([&](int t) { return binarySearch(arr.data(), 0, size - 1, t); }, queries, sums[0]);
+		double branchless = measure([&](int t) { return branchlessLowerBound(arr.data(), size, t); }, queries, sums[1]);
+		double prefetch = measure([&](int t) { return prefetchLowerBound(arr.data(), size, t); }, queries, sums[2]);
+		// Every value is twice its sorted position, so the found value tells the position to compare with others
+		double eytzinger = measure([&](int t) {
+			int k = eytzingerLowerBound(eytz.data(), size, t);
+			return k ? eytz[k] / 2 : size;
+		}, queries, sums[3]);
+		double simd = measure([&](int t) { return simdLowerBound(arr.data(), size, t); }, queries, sums[4]);
+
+		std::vector<int> results(queriesCount);
+		auto start = std::chrono::steady_clock::now();
+		batchedLowerBound(arr.data(), size, queries.data(), queriesCount, results.data());
+		auto end = std::chrono::steady_clock::now();
+		double batched = std::chrono::duration<double, std::nano>(end - start).count() / queriesCount;
+		for (int r : results) { sums[5] += r; }
+
+		// A target above all elements takes the longest descent, for 2^30 elements up to index 2^31 - 1
+		int above = 2 * (size - 1) + 1;
+		bool aboveAll = branchlessLowerBound(arr.data(), size, above) == size && prefetchLowerBound(arr.data(), size, above) == size
+			&& eytzingerLowerBound(eytz.data(), size, above) == 0 && simdLowerBound(arr.data(), size, above) == size;
+
+		std::cout << std::setw(12) << size << std::fixed << std::setprecision(1) << std::setw(14) << classic
+			<< std::setw(14) << branchless << std::setw(14) << prefetch << std::setw(14) << eytzinger
+			<< std::setw(14) << simd << std::setw(14) << batched
+			<< (sums[1] == sums[2] && sums[1] == sums[3] && sums[1] == sums[4] && sums[1] == sums[5] && aboveAll ? "" : "   (mismatch!)") << std::endl;
+	}
+}
+
 int main() {
 	// Greet
 	std::cout << "\tWelcome to the 'Binary Search' console application!\n";
@@ -47,6 +108,13 @@ int main() {
 		std::cout << "Element '" << t << "' not found.\n";
 	}
 
+	// Compare cache-friendly variants
+	std::cout << "\nSpecify the largest benchmark size as a power of two (10-30, 0 to skip): ";
+	int maxPower = 0;
+	std::cin >> maxPower;
+	if (maxPower >= 10 && maxPower <= 30) { benchmark(maxPower); }
+	std::cin.ignore();
+
 	// Exit
 	std::cout << "\nThanks for using this program! Have a great day!\n";
 	std::cout << "Press <Enter> to exit...";
@@ -0,0 +1,45 @@
+// Title:   Header file for Exponential Search
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef EXPONENTIALSEARCH_H
+#define EXPONENTIALSEARCH_H
+
+
+int exponentialSearch(int arr[], int size, int target);
+int gallopingLowerBound(const int arr[], int start, int size, int target);
+
+
+// Lower bound within any sorted source, where 'at(i)' returns its i-th element; for a source
+// of unknown length (e.g. a stream) pass INT_MAX as size and let 'at' return INT_MAX beyond
+// the end, since only O(log i) elements are read, where i is the answer
+template <typename Source>
+int exponentialLowerBound(Source at, int size, int target) {
+	if (size <= 0 || !(at(0) < target)) { return 0; }
+
+	// Double the bound until it passes the target, the answer is then within (prev, bound]
+	int prev = 0;
+	int bound = 1;
+	while (bound < size && at(bound) < target) {
+		prev = bound;
+		bound = (bound <= size / 2) ? bound * 2 : size;
+	}
+
+	int left = prev + 1;
+	int right = bound;
+	while (left < right) {
+		int mid = left + (right - left) / 2;
+		if (at(mid) < target) {
+			left = mid + 1;
+		} else {
+			right = mid;
+		}
+	}
+
+	return left;
+}
+
+
+#endif // EXPONENTIALSEARCH_H
@@ -0,0 +1,19 @@
+// Title:   Source file for Exponential Search
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "ExponentialSearch.h"
+
+
+int exponentialSearch(int arr[], int size, int target) {
+	int i = exponentialLowerBound([arr](int pos) { return arr[pos]; }, size, target);
+	return (i < size && arr[i] == target) ? i : -1;
+}
+
+// Lower bound within [start, size) found by galloping from start, as merges do when one run
+// keeps winning, so the cost is O(log d), where d is distance from start to the answer
+int gallopingLowerBound(const int arr[], int start, int size, int target) {
+	return start + exponentialLowerBound([arr, start](int pos) { return arr[start + pos]; }, size - start, target);
+}
@@ -0,0 +1,51 @@
+// Title:   Header file for Fibonacci Search
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef FIBONACCISEARCH_H
+#define FIBONACCISEARCH_H
+
+
+int fibonacciSearch(int arr[], int size, int target);
+
+
+// Lower bound within any sorted source, where 'at(i)' returns its i-th element; the interval
+// of F(k) - 1 candidates is split by Fibonacci numbers using only additions and subtractions,
+// and positions beyond the end are treated as greater than any target without being read
+template <typename Source>
+int fibonacciLowerBound(Source at, int size, int target) {
+	long long a = 0; // F(k - 2)
+	long long b = 1; // F(k - 1)
+	long long c = 1; // F(k)
+	while (c - 1 < size) {
+		a = b;
+		b = c;
+		c = a + b;
+	}
+
+	long long low = 0;
+	while (c > 1) {
+		long long i = low + b - 1;
+		if (i < size && at(static_cast<int>(i)) < target) {
+			// Answer is to the right of i, F(k - 2) - 1 candidates are left
+			low = i + 1;
+			long long nc = a;
+			long long nb = b - a;
+			a = nc - nb;
+			b = nb;
+			c = nc;
+		} else {
+			// Answer is i or to the left of it, F(k - 1) - 1 candidates are left
+			c = b;
+			b = a;
+			a = c - b;
+		}
+	}
+
+	return static_cast<int>((low < size) ? low : size);
+}
+
+
+#endif // FIBONACCISEARCH_H
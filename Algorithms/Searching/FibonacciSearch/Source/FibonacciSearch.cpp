@@ -0,0 +1,13 @@
+// Title:   Source file for Fibonacci Search
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "FibonacciSearch.h"
+
+
+int fibonacciSearch(int arr[], int size, int target) {
+	int i = fibonacciLowerBound([arr](int pos) { return arr[pos]; }, size, target);
+	return (i < size && arr[i] == target) ? i : -1;
+}
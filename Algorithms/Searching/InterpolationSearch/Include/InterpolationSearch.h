@@ -9,6 +9,7 @@
 
 
 int interpolationSearch(int arr[], int size, int target);
+int interpolationHybridSearch(int arr[], int size, int target);
 
 
 #endif // INTERPOLATIONSEARCH_H
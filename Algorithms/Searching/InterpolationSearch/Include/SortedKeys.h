@@ -0,0 +1,21 @@
+// Title:   Header file for Sorted Keys of Different Distributions
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef SORTEDKEYS_H
+#define SORTEDKEYS_H
+
+
+#include <random>
+#include <string>
+#include <vector>
+
+
+// Creates sorted keys that span the whole int range with the given distribution:
+// "Uniform", "Zipf", "Lognormal" or "Clustered" (any other name)
+std::vector<int> createKeys(const std::string& distribution, int size, std::mt19937& gen);
+
+
+#endif // SORTEDKEYS_H
@@ -4,9 +4,18 @@
 // ----------------------------------------------------------------------------
 
 
+#include <cmath>
 #include "InterpolationSearch.h"
 
 
+// Estimates position of target within [low, high] in 64-bit arithmetic, since both
+// the difference of keys and its product with the interval length overflow an int
+static int interpolate(int arr[], int low, int high, int target) {
+    long long num = (static_cast<long long>(target) - arr[low]) * (high - low);
+    long long den = static_cast<long long>(arr[high]) - arr[low];
+    return low + static_cast<int>(num / den);
+}
+
 int interpolationSearch(int arr[], int size, int target) {
     int low = 0;
     int high = size - 1;
@@ -20,7 +29,7 @@ int interpolationSearch(int arr[], int size, int target) {
             }                     
         }
 
-        int pos = low + ((target - arr[low]) * (high - low)) / (arr[high] - arr[low]);
+        int pos = interpolate(arr, low, high, target);
 
         if (arr[pos] == target) { return pos; } 
         if (arr[pos] < target) { 
@@ -31,4 +40,65 @@ int interpolationSearch(int arr[], int size, int target) {
     }
 
     return -1;
-}
\ No newline at end of file
+}
+
+// Interpolation-binary hybrid: every interpolation probe is followed by a guard probe
+// sqrt(length) elements further, so a good estimate shrinks the interval to sqrt of it;
+// estimates that miss the guard are counted, and after a few of them the search falls
+// back to plain halving, which keeps the worst case logarithmic; short intervals are scanned
+int interpolationHybridSearch(int arr[], int size, int target) {
+    const int scanLength = 16;
+    int low = 0;
+    int high = size - 1;
+    int misses = 2;
+
+    while (low <= high && target >= arr[low] && target <= arr[high]) {
+        if (high - low < scanLength) {
+            for (int i = low; i <= high; i++) {
+                if (arr[i] == target) { return i; }
+            }
+            return -1;
+        }
+
+        if (misses == 0 || arr[low] == arr[high]) {
+            int mid = low + (high - low) / 2;
+            if (arr[mid] == target) { return mid; }
+            if (arr[mid] < target) { 
+                low = mid + 1; 
+            } else { 
+                high = mid - 1; 
+            }
+            continue;
+        }
+
+        int pos = interpolate(arr, low, high, target);
+        if (arr[pos] == target) { return pos; }
+
+        int gap = static_cast<int>(std::sqrt(static_cast<double>(high - low)));
+        if (arr[pos] < target) {
+            low = pos + 1;
+            int guard = pos + gap;
+            if (guard < high) {
+                if (arr[guard] < target) {
+                    low = guard + 1;
+                    misses--;
+                } else {
+                    high = guard;
+                }
+            }
+        } else {
+            high = pos - 1;
+            int guard = pos - gap;
+            if (guard > low) {
+                if (arr[guard] > target) {
+                    high = guard - 1;
+                    misses--;
+                } else {
+                    low = guard;
+                }
+            }
+        }
+    }
+
+    return -1;
+}
@@ -6,7 +6,13 @@
 
 #include <iostream>
 #include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
 #include "InterpolationSearch.h"
+#include "SortedKeys.h"
+#include "BinarySearch.h"   // From the Binary Search folder
 
 
 void printArray(int arr[], int size) {
@@ -23,6 +29,39 @@ void printArray(int arr[], int size) {
 	std::cout << std::endl;
 }
 
+// Compares average nanoseconds per lookup, half of the targets are present in the array
+void benchmark(int power) {
+	const int size = 1 << power;
+	const int queriesCount = 1 << 12;
+	std::mt19937 gen(42);
+
+	std::cout << std::setw(12) << "Distribution" << std::setw(14) << "binarySearch" << std::setw(14) << "Interpolation"
+		<< std::setw(14) << "Hybrid" << "   (ns per lookup)\n";
+	for (std::string distribution : { "Uniform", "Zipf", "Clustered" }) {
+		std::vector<int> arr = createKeys(distribution, size, gen);
+		std::vector<int> queries(queriesCount);
+		for (int i = 0; i < queriesCount; i++) { queries[i] = (i % 2) ? arr[gen() % size] : static_cast<int>(gen()); }
+
+		double ns[3] = {};
+		long long found[3] = {};
+		for (int v = 0; v < 3; v++) {
+			auto start = std::chrono::steady_clock::now();
+			for (int q : queries) {
+				int i = (v == 0) ? binarySearch(arr.data(), 0, size - 1, q)
+					: (v == 1) ? interpolationSearch(arr.data(), size, q)
+					: interpolationHybridSearch(arr.data(), size, q);
+				found[v] += (i != -1 && arr[i] == q);
+			}
+			auto end = std::chrono::steady_clock::now();
+			ns[v] = std::chrono::duration<double, std::nano>(end - start).count() / queriesCount;
+		}
+
+		std::cout << std::setw(12) << distribution << std::fixed << std::setprecision(1) << std::setw(14) << ns[0]
+			<< std::setw(14) << ns[1] << std::setw(14) << ns[2]
+			<< (found[0] == found[1] && found[0] == found[2] ? "" : "   (mismatch!)") << std::endl;
+	}
+}
+
 int main() {
 	// Greet
 	std::cout << "\tWelcome to the 'Interpolation Search' console application!\n";
@@ -47,6 +86,13 @@ int main() {
 		std::cout << "Element '" << t << "' not found.\n";
 	}
 
+	// Compare on different distributions
+	std::cout << "\nSpecify the benchmark size as a power of two (10-24, 0 to skip): ";
+	int power = 0;
+	std::cin >> power;
+	if (power >= 10 && power <= 24) { benchmark(power); }
+	std::cin.ignore();
+
 	// Exit
 	std::cout << "\nThanks for using this program! Have a great day!\n";
 	std::cout << "Press <Enter> to exit...";
@@ -0,0 +1,36 @@
+// Title:   Source file for Sorted Keys of Different Distributions
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <cmath>
+#include <climits>
+#include <algorithm>
+#include "SortedKeys.h"
+
+
+std::vector<int> createKeys(const std::string& distribution, int size, std::mt19937& gen) {
+	std::vector<int> keys(size);
+	std::uniform_real_distribution<double> unit(0.0, 1.0);
+	std::lognormal_distribution<double> lognormal(0.0, 2.0);
+	const double range = 4294967295.0;
+
+	if (distribution == "Uniform") {
+		for (int& k : keys) { k = static_cast<int>(INT_MIN + unit(gen) * range); }
+	} else if (distribution == "Zipf") {
+		// Pareto is the continuous analogue of Zipf: most keys are small, few are huge
+		for (int& k : keys) { k = static_cast<int>(INT_MIN + std::min(range, std::pow(1.0 - unit(gen), -1.0 / 0.5))); }
+	} else if (distribution == "Lognormal") {
+		// Typical shape of sizes, prices and timestamps deltas
+		for (int& k : keys) { k = static_cast<int>(INT_MIN + std::min(range, lognormal(gen) * 1e6)); }
+	} else {
+		// Dense clusters around a few random centers, separated by huge gaps
+		std::vector<double> centers(16);
+		for (double& c : centers) { c = INT_MIN + unit(gen) * (range - 1e6); }
+		for (int& k : keys) { k = static_cast<int>(centers[gen() % centers.size()] + unit(gen) * 1e6); }
+	}
+
+	std::sort(keys.begin(), keys.end());
+	return keys;
+}
@@ -0,0 +1,37 @@
+// Title:   Header file for Jump Search
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef JUMPSEARCH_H
+#define JUMPSEARCH_H
+
+
+int jumpSearch(int arr[], int size, int target);
+
+
+// Lower bound within any sorted source, where 'at(i)' returns its i-th element; positions are
+// read in increasing order except for a single step back to the start of the found block, which
+// suits media where moving back is expensive (tapes, compressed blocks)
+template <typename Source>
+int jumpLowerBound(Source at, int size, int target) {
+	int step = 1;
+	while (static_cast<long long>(step) * step < size) { step++; } // ceil(sqrt(size)) balances jumps and scanned block
+
+	// Jump over whole blocks while their last element is still less than target
+	int prev = 0;
+	int next = (step < size) ? step : size;
+	while (next < size && at(next - 1) < target) {
+		prev = next;
+		next = (size - next > step) ? next + step : size;
+	}
+
+	// Scan the block that contains the answer
+	while (prev < next && at(prev) < target) { prev++; }
+
+	return prev;
+}
+
+
+#endif // JUMPSEARCH_H
@@ -0,0 +1,13 @@
+// Title:   Source file for Jump Search
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include "JumpSearch.h"
+
+
+int jumpSearch(int arr[], int size, int target) {
+	int i = jumpLowerBound([arr](int pos) { return arr[pos]; }, size, target);
+	return (i < size && arr[i] == target) ? i : -1;
+}
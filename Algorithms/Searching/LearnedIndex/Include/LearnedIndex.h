@@ -0,0 +1,41 @@
+// Title:   Header file for Learned Index
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef LEARNEDINDEX_H
+#define LEARNEDINDEX_H
+
+
+#include <cstddef>
+#include <vector>
+
+
+class LearnedIndex {
+private:
+    struct Segment {
+        int key;                              // First key covered by the segment
+        int intercept;                        // Position of that key
+        double slope;                         // Positions per unit of key
+    };
+
+    const int* arr = nullptr;                 // Indexed array, it is not copied and must outlive the index
+    int size = 0;
+    int epsilon = 0;                          // Maximum error of every prediction
+    std::vector<std::vector<Segment>> levels; // Level 0 approximates the array, each next one approximates the previous
+
+    static std::vector<Segment> buildLevel(const std::vector<int>& keys, const std::vector<int>& positions, int epsilon);
+    static int predict(const Segment& segment, int target, int next);
+    static int windowLowerBound(const int arr[], int left, int right, int target);
+
+public:
+    LearnedIndex(const int arr[], int size, int epsilon = 64);
+    int lowerBound(int target) const;
+    int search(int target) const;
+    int segmentsCount() const;
+    std::size_t memoryUsage() const;
+};
+
+
+#endif // LEARNEDINDEX_H
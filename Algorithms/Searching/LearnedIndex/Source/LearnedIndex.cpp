@@ -0,0 +1,148 @@
+// Title:   Source file for Learned Index
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <limits>
+#include "LearnedIndex.h"
+
+
+// Splits points into the fewest greedy segments ("shrinking cone"): a segment is extended
+// while there is still a slope, which keeps every point within epsilon from the line
+std::vector<LearnedIndex::Segment> LearnedIndex::buildLevel(const std::vector<int>& keys, const std::vector<int>& positions, int epsilon) {
+    std::vector<Segment> segments;
+    int n = static_cast<int>(keys.size());
+    int start = 0;
+    double lowSlope = 0.0;
+    double highSlope = std::numeric_limits<double>::infinity();
+
+    for (int j = 1; j <= n; j++) {
+        bool fits = false;
+        if (j < n) {
+            double dx = static_cast<double>(keys[j]) - keys[start];
+            double dy = static_cast<double>(positions[j]) - positions[start];
+            double low = (dy - epsilon) / dx;
+            double high = (dy + epsilon) / dx;
+            fits = (low <= highSlope && high >= lowSlope);
+            if (fits) {
+                lowSlope = std::max(lowSlope, low);
+                highSlope = std::min(highSlope, high);
+            }
+        }
+
+        if (!fits) {
+            double slope = (j - start > 1) ? (lowSlope + highSlope) / 2 : 0.0;
+            segments.push_back({ keys[start], positions[start], slope });
+            start = j;
+            lowSlope = 0.0;
+            highSlope = std::numeric_limits<double>::infinity();
+        }
+    }
+
+    return segments;
+}
+
+// Builds the bottom level over the first occurrences of distinct keys, and then keeps
+// approximating the first keys of segments until a single segment is left
+LearnedIndex::LearnedIndex(const int arr[], int size, int epsilon) : arr(arr), size(size), epsilon(epsilon) {
+    std::vector<int> keys;
+    std::vector<int> positions;
+    for (int i = 0; i < size; i++) {
+        if (i == 0 || arr[i] != arr[i - 1]) {
+            keys.push_back(arr[i]);
+            positions.push_back(i);
+        }
+    }
+    if (keys.empty()) { return; }
+
+    levels.push_back(buildLevel(keys, positions, epsilon));
+    while (levels.back().size() > 1) {
+        const std::vector<Segment>& below = levels.back();
+        keys.resize(below.size());
+        positions.resize(below.size());
+        for (int i = 0; i < static_cast<int>(below.size()); i++) {
+            keys[i] = below[i].key;
+            positions[i] = i;
+        }
+        levels.push_back(buildLevel(keys, positions, epsilon));
+    }
+}
+
+// Predicted position, clamped so it never leaves the part of the array covered by the segment
+int LearnedIndex::predict(const Segment& segment, int target, int next) {
+    double pos = segment.intercept + segment.slope * (static_cast<double>(target) - segment.key);
+    return static_cast<int>(std::min(std::max(pos, static_cast<double>(segment.intercept)), static_cast<double>(next)));
+}
+
+// Binary search for the first element within [left, right) that is not less than target
+int LearnedIndex::windowLowerBound(const int arr[], int left, int right, int target) {
+    while (left < right) {
+        int mid = left + (right - left) / 2;
+        if (arr[mid] < target) {
+            left = mid + 1;
+        } else {
+            right = mid;
+        }
+    }
+    return left;
+}
+
+// Descends the levels, each prediction narrows the search to 2 * epsilon + 2 elements of the level below
+int LearnedIndex::lowerBound(int target) const {
+    if (levels.empty()) { return 0; }
+
+    int s = 0;
+    for (int h = static_cast<int>(levels.size()) - 1; h > 0; h--) {
+        const std::vector<Segment>& level = levels[h];
+        const std::vector<Segment>& below = levels[h - 1];
+        int count = static_cast<int>(below.size());
+        int next = (s + 1 < static_cast<int>(level.size())) ? level[s + 1].intercept : count;
+        int pos = predict(level[s], target, next);
+
+        // Last segment below whose first key is not greater than target
+        int left = std::max(pos - epsilon - 1, 0);
+        int right = std::min(pos + epsilon + 2, count);
+        while (left < right) {
+            int mid = left + (right - left) / 2;
+            if (below[mid].key <= target) {
+                left = mid + 1;
+            } else {
+                right = mid;
+            }
+        }
+        s = std::max(left - 1, 0);
+    }
+
+    const std::vector<Segment>& bottom = levels[0];
+    int next = (s + 1 < static_cast<int>(bottom.size())) ? bottom[s + 1].intercept : size;
+    int pos = predict(bottom[s], target, next);
+    int left = std::max(pos - epsilon - 1, 0);
+    int right = std::min(pos + epsilon + 2, size);
+
+    // Only long runs of duplicates can push the answer beyond the window, gallop over them
+    for (int step = epsilon + 1; right < size && arr[right - 1] < target; step *= 2) {
+        left = right;
+        right = std::min(right + step, size);
+    }
+
+    return windowLowerBound(arr, left, right, target);
+}
+
+// Same contract as binary search: index of the target or -1 if it is absent
+int LearnedIndex::search(int target) const {
+    int i = lowerBound(target);
+    return (i < size && arr[i] == target) ? i : -1;
+}
+
+int LearnedIndex::segmentsCount() const {
+    int count = 0;
+    for (const std::vector<Segment>& level : levels) { count += static_cast<int>(level.size()); }
+    return count;
+}
+
+// Bytes occupied by the model itself, the indexed array is not included
+std::size_t LearnedIndex::memoryUsage() const {
+    return sizeof(*this) + levels.capacity() * sizeof(std::vector<Segment>) + segmentsCount() * sizeof(Segment);
+}
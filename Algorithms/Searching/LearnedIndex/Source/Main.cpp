@@ -0,0 +1,106 @@
+// Title:   Learned Index Search Structure
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include "LearnedIndex.h"
+#include "BinarySearch.h"          // From the Binary Search folder
+#include "InterpolationSearch.h"   // From the Interpolation Search folder
+#include "SortedKeys.h"            // From the Interpolation Search folder
+
+
+void printArray(int arr[], int size) {
+	std::cout << "Elements:\t";
+	for (int i = 0; i < size; i++) {
+		std::cout << std::setw(3) << arr[i] << " ";
+	}
+	std::cout << std::endl;
+
+	std::cout << "Indices:\t";
+	for (int i = 0; i < size; i++) {
+		std::cout << std::setw(3) << i << " ";
+	}
+	std::cout << std::endl;
+}
+
+// Compares average nanoseconds per lookup and memory of the model, half of the targets are present
+void benchmark(int power) {
+	const int size = 1 << power;
+	const int queriesCount = 1 << 12;
+	std::mt19937 gen(42);
+
+	std::cout << std::setw(12) << "Distribution" << std::setw(14) << "binarySearch" << std::setw(14) << "Interpolation"
+		<< std::setw(14) << "LearnedIndex" << std::setw(10) << "Segments" << std::setw(12) << "Memory, KB" << "   (ns per lookup)\n";
+	for (std::string distribution : { "Uniform", "Zipf", "Lognormal", "Clustered" }) {
+		std::vector<int> arr = createKeys(distribution, size, gen);
+		LearnedIndex index(arr.data(), size);
+		std::vector<int> queries(queriesCount);
+		for (int i = 0; i < queriesCount; i++) { queries[i] = (i % 2) ? arr[gen() % size] : static_cast<int>(gen()); }
+
+		double ns[3] = {};
+		long long found[3] = {};
+		for (int v = 0; v < 3; v++) {
+			auto start = std::chrono::steady_clock::now();
+			for (int q : queries) {
+				int i = (v == 0) ? binarySearch(arr.data(), 0, size - 1, q)
+					: (v == 1) ? interpolationSearch(arr.data(), size, q)
+					: index.search(q);
+				found[v] += (i != -1 && arr[i] == q);
+			}
+			auto end = std::chrono::steady_clock::now();
+			ns[v] = std::chrono::duration<double, std::nano>(end - start).count() / queriesCount;
+		}
+
+		std::cout << std::setw(12) << distribution << std::fixed << std::setprecision(1) << std::setw(14) << ns[0]
+			<< std::setw(14) << ns[1] << std::setw(14) << ns[2] << std::setw(10) << index.segmentsCount()
+			<< std::setw(12) << index.memoryUsage() / 1024.0
+			<< (found[0] == found[1] && found[0] == found[2] ? "" : "   (mismatch!)") << std::endl;
+	}
+}
+
+int main() {
+	// Greet
+	std::cout << "\tWelcome to the 'Learned Index' console application!\n";
+
+	// Create initial array and build the index over it
+	std::cout << "\nCreating the initial array...\n";
+	int arr[] = { 1, 1, 4, 7, 9, 11, 14, 17, 19, 19, 22, 25, 27, 30, 52, 61, 75, 88, 90, 99 };
+	int size = sizeof(arr) / sizeof(arr[1]);
+	printArray(arr, size);
+	LearnedIndex index(arr, size, 1);
+	std::cout << "Index is built with '" << index.segmentsCount() << "' linear segments.\n";
+
+	// Specify the target 
+	std::cout << "\nSpecify the target: ";
+	int t = 0;
+	std::cin >> t;
+
+	// Search for the value
+	std::cout << "\nSearching the element '" << t << "'..." << std::endl;
+	int i = index.search(t);
+	if (i != -1) {
+		std::cout << "Element '" << t << "' found at index '" << i << "'.\n";
+	} else {
+		std::cout << "Element '" << t << "' not found.\n";
+	}
+
+	// Compare on different distributions
+	std::cout << "\nSpecify the benchmark size as a power of two (10-24, 0 to skip): ";
+	int power = 0;
+	std::cin >> power;
+	if (power >= 10 && power <= 24) { benchmark(power); }
+	std::cin.ignore();
+
+	// Exit
+	std::cout << "\nThanks for using this program! Have a great day!\n";
+	std::cout << "Press <Enter> to exit...";
+	std::cin.get();
+	return 0;
+}
@@ -10,5 +10,27 @@
 
 int linearSearch(int arr[], int size, int target);
 
+// Vectorized variants (AVX2, then SSE2, then scalar fallback, depending on the build)
+int simdLinearSearch(const int arr[], int size, int target);
+int simdLinearSearchMulti(const int arr[], int size, const int targets[], int count, int results[]);
+int simdLinearCount(const int arr[], int size, int target);
+int simdLinearFindAll(const int arr[], int size, int target, int indices[]);
 
-#endif // LINEARSEARCH_H
\ No newline at end of file
+// Parallel variants (threadsCount <= 0 means one thread per hardware thread),
+// results are the same as of the serial versions regardless of the number of threads
+int parallelLinearSearch(const int arr[], int size, int target, int threadsCount = 0);
+int parallelLinearCount(const int arr[], int size, int target, int threadsCount = 0);
+int parallelLinearFindAll(const int arr[], int size, int target, int indices[], int threadsCount = 0);
+
+
+// Lower bound within any sorted source, where 'at(i)' returns its i-th element; reads
+// every element before the answer, which is cheap only when the answer is near the start
+template <typename Source>
+int linearLowerBound(Source at, int size, int target) {
+	int i = 0;
+	while (i < size && at(i) < target) { i++; }
+	return i;
+}
+
+
+#endif // LINEARSEARCH_H
@@ -5,6 +5,25 @@
 
 
 #include "LinearSearch.h"
+#include <thread>
+#include <atomic>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LINEARSEARCH_SSE2
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+static int countTrailingZeros(unsigned int x) { unsigned long i; _BitScanForward(&i, x); return static_cast<int>(i); }
+static int popCount(unsigned int x) { return static_cast<int>(__popcnt(x)); }
+#else
+static int countTrailingZeros(unsigned int x) { return __builtin_ctz(x); }
+static int popCount(unsigned int x) { return __builtin_popcount(x); }
+#endif
 
 
 int linearSearch(int arr[], int size, int target) {
@@ -13,4 +32,185 @@ int linearSearch(int arr[], int size, int target) {
 	}
 			
 	return -1;
-}
\ No newline at end of file
+}
+
+// Bit i of the result is set if arr[i] == target, for the block of 'lanes' elements at arr
+#if defined(__AVX2__)
+static const int lanes = 16;
+static unsigned int matchMask(const int* arr, int target) {
+	__m256i t = _mm256_set1_epi32(target);
+	__m256i lo = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(arr)), t);
+	__m256i hi = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(arr + 8)), t);
+	return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(lo)))
+		| (static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(hi))) << 8);
+}
+#elif defined(LINEARSEARCH_SSE2)
+static const int lanes = 8;
+static unsigned int matchMask(const int* arr, int target) {
+	__m128i t = _mm_set1_epi32(target);
+	__m128i lo = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(arr)), t);
+	__m128i hi = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(arr + 4)), t);
+	return static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(lo)))
+		| (static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(hi))) << 4);
+}
+#else
+static const int lanes = 8;
+static unsigned int matchMask(const int* arr, int target) {
+	unsigned int mask = 0;
+	for (int j = 0; j < lanes; j++) { mask |= static_cast<unsigned int>(arr[j] == target) << j; }
+	return mask;
+}
+#endif
+
+// Compares a whole block at once and leaves the loop on the first non-empty mask,
+// the lowest set bit of which is the first match; the tail is scanned one by one
+int simdLinearSearch(const int arr[], int size, int target) {
+	int i = 0;
+	for (; i <= size - lanes; i += lanes) {
+		unsigned int mask = matchMask(arr + i, target);
+		if (mask) { return i + countTrailingZeros(mask); }
+	}
+	for (; i < size; i++) {
+		if (arr[i] == target) { return i; }
+	}
+
+	return -1;
+}
+
+// Searches for several targets in one pass over the array: results[j] receives the first
+// index of targets[j] or -1, the scan stops as soon as every target is found
+int simdLinearSearchMulti(const int arr[], int size, const int targets[], int count, int results[]) {
+	int remaining = count;
+	for (int j = 0; j < count; j++) { results[j] = -1; }
+
+	int i = 0;
+	for (; i <= size - lanes && remaining > 0; i += lanes) {
+		for (int j = 0; j < count; j++) {
+			if (results[j] != -1) { continue; }
+			unsigned int mask = matchMask(arr + i, targets[j]);
+			if (mask) {
+				results[j] = i + countTrailingZeros(mask);
+				remaining--;
+			}
+		}
+	}
+	for (; i < size && remaining > 0; i++) {
+		for (int j = 0; j < count; j++) {
+			if (results[j] == -1 && arr[i] == targets[j]) {
+				results[j] = i;
+				remaining--;
+			}
+		}
+	}
+
+	return count - remaining;
+}
+
+// Number of occurrences of target
+int simdLinearCount(const int arr[], int size, int target) {
+	int count = 0;
+	int i = 0;
+	for (; i <= size - lanes; i += lanes) { count += popCount(matchMask(arr + i, target)); }
+	for (; i < size; i++) { count += (arr[i] == target); }
+
+	return count;
+}
+
+// Writes indices of all occurrences of target in ascending order, returns their number;
+// 'indices' must have room for 'size' elements in the worst case
+int simdLinearFindAll(const int arr[], int size, int target, int indices[]) {
+	int count = 0;
+	int i = 0;
+	for (; i <= size - lanes; i += lanes) {
+		for (unsigned int mask = matchMask(arr + i, target); mask; mask &= mask - 1) {
+			indices[count++] = i + countTrailingZeros(mask);
+		}
+	}
+	for (; i < size; i++) {
+		if (arr[i] == target) { indices[count++] = i; }
+	}
+
+	return count;
+}
+
+// Number of threads worth starting for an array: small arrays do not pay off the cost
+// of starting a thread, so every thread gets at least 'minChunk' elements
+static int chunksCount(int size, int threadsCount) {
+	const int minChunk = 1 << 16;
+	if (threadsCount <= 0) { threadsCount = static_cast<int>(std::thread::hardware_concurrency()); }
+	if (threadsCount > size / minChunk) { threadsCount = size / minChunk; }
+	return (threadsCount < 1) ? 1 : threadsCount;
+}
+
+// Splits [0, size) into 'chunks' contiguous parts and runs work(index, begin, end) on each of
+// them in its own thread, the first part is processed by the calling thread itself
+template <typename Work>
+static void runChunks(int size, int chunks, Work work) {
+	long long length = (static_cast<long long>(size) + chunks - 1) / chunks;
+	std::vector<std::thread> threads;
+	for (int t = 1; t < chunks; t++) {
+		long long end = length * (t + 1);
+		threads.emplace_back(work, t, static_cast<int>(length * t), static_cast<int>(end < size ? end : size));
+	}
+	work(0, 0, static_cast<int>(length < size ? length : size));
+	for (std::thread& thread : threads) { thread.join(); }
+}
+
+// Each thread scans its chunk by blocks; the lowest match found so far is shared, so a thread
+// stops as soon as it is below the current block, as nothing there can be any better
+int parallelLinearSearch(const int arr[], int size, int target, int threadsCount) {
+	const int block = 1 << 14;
+	std::atomic<int> first(size);
+
+	runChunks(size, chunksCount(size, threadsCount), [&](int, int begin, int end) {
+		for (int i = begin, length = 0; i < end && i < first.load(std::memory_order_relaxed); i += length) {
+			length = (end - i < block) ? end - i : block;   // so that 'i' never goes past 'end' and overflows
+			int j = simdLinearSearch(arr + i, length, target);
+			if (j == -1) { continue; }
+
+			int found = i + j;
+			int current = first.load(std::memory_order_relaxed);
+			while (found < current && !first.compare_exchange_weak(current, found, std::memory_order_relaxed)) {}
+			return;
+		}
+	});
+
+	return (first.load() < size) ? first.load() : -1;
+}
+
+// Number of occurrences of target, each thread counts its own chunk
+int parallelLinearCount(const int arr[], int size, int target, int threadsCount) {
+	int chunks = chunksCount(size, threadsCount);
+	std::vector<int> counts(chunks, 0);
+
+	runChunks(size, chunks, [&](int t, int begin, int end) {
+		counts[t] = simdLinearCount(arr + begin, end - begin, target);
+	});
+
+	int count = 0;
+	for (int c : counts) { count += c; }
+	return count;
+}
+
+// Each thread collects indices of its chunk separately, then they are concatenated in the
+// order of chunks, so indices come out ascending just like from the serial version
+int parallelLinearFindAll(const int arr[], int size, int target, int indices[], int threadsCount) {
+	const int block = 1 << 14;
+	int chunks = chunksCount(size, threadsCount);
+	std::vector<std::vector<int>> found(chunks);
+
+	runChunks(size, chunks, [&](int t, int begin, int end) {
+		std::vector<int> buffer(block);
+		for (int i = begin, length = 0; i < end; i += length) {
+			length = (end - i < block) ? end - i : block;
+			int count = simdLinearFindAll(arr + i, length, target, buffer.data());
+			for (int j = 0; j < count; j++) { found[t].push_back(i + buffer[j]); }
+		}
+	});
+
+	int count = 0;
+	for (const std::vector<int>& local : found) {
+		for (int i : local) { indices[count++] = i; }
+	}
+	return count;
+}
@@ -5,6 +5,13 @@
 
 
 #include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <thread>
+#include <climits>
 #include "LinearSearch.h"
 
 
@@ -21,6 +28,84 @@ void printArray(int arr[], int size) {
 	}
 }
 
+// Compares average nanoseconds per search on unsorted arrays of different lengths,
+// targets are drawn from a range twice as large as the array, so half of them are absent
+void benchmark() {
+	const int queriesCount = 1 << 16;
+	std::mt19937 gen(42);
+
+	std::cout << std::setw(12) << "Size" << std::setw(14) << "linearSearch" << std::setw(14) << "SIMD" << "   (ns per search)\n";
+	for (int size : { 8, 16, 32, 64, 128, 256, 1024, 4096, 65536 }) {
+		std::vector<int> arr(size);
+		std::uniform_int_distribution<int> dist(0, 2 * size - 1);
+		for (int& x : arr) { x = dist(gen); }
+		std::vector<int> queries(queriesCount);
+		for (int& q : queries) { q = dist(gen); }
+
+		int repeat = std::max(1, (1 << 22) / (queriesCount * size / 8 + 1));
+		long long sums[2] = {};
+		auto t0 = std::chrono::steady_clock::now();
+		for (int r = 0; r < repeat; r++) {
+			for (int q : queries) { sums[0] += linearSearch(arr.data(), size, q); }
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		for (int r = 0; r < repeat; r++) {
+			for (int q : queries) { sums[1] += simdLinearSearch(arr.data(), size, q); }
+		}
+		auto t2 = std::chrono::steady_clock::now();
+
+		double total = static_cast<double>(queriesCount) * repeat;
+		std::cout << std::setw(12) << size << std::fixed << std::setprecision(1)
+			<< std::setw(14) << std::chrono::duration<double, std::nano>(t1 - t0).count() / total
+			<< std::setw(14) << std::chrono::duration<double, std::nano>(t2 - t1).count() / total
+			<< (sums[0] == sums[1] ? "" : "   (mismatch!)") << std::endl;
+	}
+}
+
+// Measures memory bandwidth utilization of whole scans over large unsorted arrays: the target
+// is absent for search, so every element has to be read, just like for count and find-all
+void parallelBenchmark(int maxPower) {
+	std::mt19937 gen(42);
+	std::cout << "Using " << std::thread::hardware_concurrency() << " hardware thread(-s)\n";
+	std::cout << std::setw(12) << "Size" << std::setw(10) << "Search" << std::setw(10) << "Parallel"
+		<< std::setw(10) << "Count" << std::setw(10) << "Parallel" << std::setw(10) << "FindAll" << std::setw(10) << "Parallel"
+		<< "   (GB/s)\n";
+	for (int power = 20; power <= maxPower; power += 2) {
+		int size = 1 << power;
+		std::vector<int> arr(size);
+		std::uniform_int_distribution<int> dist(0, 1 << 20);
+		for (int& x : arr) { x = dist(gen); }
+		const int absent = -1;
+		const int present = arr[gen() % size];
+		std::vector<int> indices(size);
+
+		double seconds[6] = {};
+		long long results[6] = {};
+		int repeat = std::max(1, (1 << 27) / size);
+		for (int v = 0; v < 6; v++) {
+			auto start = std::chrono::steady_clock::now();
+			for (int r = 0; r < repeat; r++) {
+				switch (v) {
+				case 0: results[v] += simdLinearSearch(arr.data(), size, absent); break;
+				case 1: results[v] += parallelLinearSearch(arr.data(), size, absent); break;
+				case 2: results[v] += simdLinearCount(arr.data(), size, present); break;
+				case 3: results[v] += parallelLinearCount(arr.data(), size, present); break;
+				case 4: results[v] += simdLinearFindAll(arr.data(), size, present, indices.data()); break;
+				case 5: results[v] += parallelLinearFindAll(arr.data(), size, present, indices.data()); break;
+				}
+			}
+			auto end = std::chrono::steady_clock::now();
+			seconds[v] = std::chrono::duration<double>(end - start).count();
+		}
+
+		double bytes = static_cast<double>(size) * sizeof(int) * repeat;
+		std::cout << std::setw(12) << size << std::fixed << std::setprecision(2);
+		for (int v = 0; v < 6; v++) { std::cout << std::setw(10) << bytes / seconds[v] / 1e9; }
+		bool match = results[0] == results[1] && results[2] == results[3] && results[4] == results[5];
+		std::cout << (match ? "" : "   (mismatch!)") << std::endl;
+	}
+}
+
 int main() {
 	// Greet
 	std::cout << "\tWelcome to the 'Linear Search' console application!\n";
@@ -45,6 +130,39 @@ int main() {
 		std::cout << "Element '" << t << "' not found.\n";
 	}
 
+	// Search for all occurrences and for several targets at once
+	int indices[sizeof(arr) / sizeof(arr[1])];
+	int count = simdLinearFindAll(arr, size, t, indices);
+	std::cout << "Element '" << t << "' occurs '" << simdLinearCount(arr, size, t) << "' time(-s):";
+	for (int j = 0; j < count; j++) { std::cout << " " << indices[j]; }
+	std::cout << std::endl;
+
+	// Neighbours of the target, clamped to stay within int
+	int targets[] = { t, t < INT_MAX ? t + 1 : t, t > INT_MIN ? t - 1 : t };
+	int results[3];
+	simdLinearSearchMulti(arr, size, targets, 3, results);
+	std::cout << "Searching the elements '" << targets[0] << "', '" << targets[1] << "', '" << targets[2] << "' in a single pass...\n";
+	for (int j = 0; j < 3; j++) {
+		if (results[j] != -1) {
+			std::cout << "Element '" << targets[j] << "' found at index '" << results[j] << "'.\n";
+		} else {
+			std::cout << "Element '" << targets[j] << "' not found.\n";
+		}
+	}
+
+	// Compare with the scalar version
+	std::cout << "\nRun the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) { benchmark(); }
+
+	// Compare with the single-threaded version on large arrays
+	std::cout << "\nSpecify the parallel benchmark max size as a power of two (20-28, 0 to skip): ";
+	int power = 0;
+	std::cin >> power;
+	if (power >= 20 && power <= 28) { parallelBenchmark(power); }
+	std::cin.ignore();
+
 	// Exit
 	std::cout << "\nThanks for using this program! Have a great day!\n";
 	std::cout << "Press <Enter> to exit...";
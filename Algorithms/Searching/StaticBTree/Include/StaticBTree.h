@@ -0,0 +1,38 @@
+// Title:   Header file for Static B-Tree
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#ifndef STATICBTREE_H
+#define STATICBTREE_H
+
+
+#include <vector>
+
+
+class StaticBTree {
+private:
+    static const int B = 16;                  // Keys per node, 16 ints fill exactly one 64-byte cache line
+
+    struct alignas(64) Node {
+        int keys[B];
+    };
+
+    std::vector<Node> nodes;                  // All layers stored one after another, leaves first
+    std::vector<int> offsets;                 // Index of the first node of each layer
+    int size = 0;
+
+    static int rank(const Node& node, int target);
+
+public:
+    StaticBTree(const int arr[], int size);
+    int lowerBound(int target) const;
+    int upperBound(int target) const;
+    int search(int target) const;
+    int rangeCount(int low, int high) const;
+    void lowerBoundBatch(const int targets[], int count, int results[]) const;
+};
+
+
+#endif // STATICBTREE_H
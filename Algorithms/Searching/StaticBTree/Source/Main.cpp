@@ -0,0 +1,109 @@
+// Title:   Static B-Tree Search Structure
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include "StaticBTree.h"
+#include "BinarySearch.h"   // From the Binary Search folder
+
+
+void printArray(int arr[], int size) {
+	std::cout << "Elements:\t";
+	for (int i = 0; i < size; i++) {
+		std::cout << std::setw(3) << arr[i] << " ";
+	}
+	std::cout << std::endl;
+
+	std::cout << "Indices:\t";
+	for (int i = 0; i < size; i++) {
+		std::cout << std::setw(3) << i << " ";
+	}
+	std::cout << std::endl;
+}
+
+// Compares average nanoseconds per lookup on sorted arrays of 2^10 up to 2^maxPower elements
+void benchmark(int maxPower) {
+	const int queriesCount = 1 << 20;
+	std::mt19937 gen(42);
+
+	std::cout << std::setw(12) << "Size" << std::setw(14) << "binarySearch" << std::setw(14) << "lowerBound"
+		<< std::setw(14) << "Batch" << "   (ns per lookup)\n";
+	for (int p = 10; p <= maxPower; p += 2) {
+		int size = 1 << p;
+		std::vector<int> arr(size);
+		for (int i = 0; i < size; i++) { arr[i] = 2 * i; }
+		StaticBTree tree(arr.data(), size);
+
+		std::uniform_int_distribution<int> dist(0, 2 * (size - 1) + 1);   // 2 * size - 1 overflows for 2^30
+		std::vector<int> queries(queriesCount);
+		for (int& q : queries) { q = dist(gen); }
+		std::vector<int> results(queriesCount);
+		long long found[3] = {};
+
+		auto t0 = std::chrono::steady_clock::now();
+		for (int q : queries) { found[0] += (binarySearch(arr.data(), 0, size - 1, q) != -1); }
+		auto t1 = std::chrono::steady_clock::now();
+		for (int q : queries) { found[1] += (arr[tree.lowerBound(q) % size] == q); }
+		auto t2 = std::chrono::steady_clock::now();
+		tree.lowerBoundBatch(queries.data(), queriesCount, results.data());
+		auto t3 = std::chrono::steady_clock::now();
+		for (int i = 0; i < queriesCount; i++) { found[2] += (arr[results[i] % size] == queries[i]); }
+
+		auto ns = [&](auto from, auto to) { return std::chrono::duration<double, std::nano>(to - from).count() / queriesCount; };
+		std::cout << std::setw(12) << size << std::fixed << std::setprecision(1) << std::setw(14) << ns(t0, t1)
+			<< std::setw(14) << ns(t1, t2) << std::setw(14) << ns(t2, t3)
+			<< (found[0] == found[1] && found[0] == found[2] ? "" : "   (mismatch!)") << std::endl;
+	}
+}
+
+int main() {
+	// Greet
+	std::cout << "\tWelcome to the 'Static B-Tree' console application!\n";
+
+	// Create initial array and build the tree over it
+	std::cout << "\nCreating the initial array...\n";
+	int arr[] = { 0, 2, 2, 3, 4, 6, 7, 9, 10, 12, 13, 14, 15, 19, 19, 21, 22, 25, 27, 30 };
+	int size = sizeof(arr) / sizeof(arr[1]);
+	printArray(arr, size);
+	StaticBTree tree(arr, size);
+
+	// Specify the target 
+	std::cout << "\nSpecify the target: ";
+	int t = 0;
+	std::cin >> t;
+
+	// Search for the value
+	std::cout << "\nSearching the element '" << t << "'..." << std::endl;
+	int i = tree.search(t);
+	if (i != -1) {
+		std::cout << "Element '" << t << "' found at index '" << i << "'.\n";
+	} else {
+		std::cout << "Element '" << t << "' not found, it would be inserted at index '" << tree.lowerBound(t) << "'.\n";
+	}
+
+	// Count values within the range
+	std::cout << "\nSpecify the range (low high): ";
+	int low = 0;
+	int high = 0;
+	std::cin >> low >> high;
+	std::cout << "There are '" << tree.rangeCount(low, high) << "' elements within [" << low << ", " << high << "].\n";
+
+	// Compare with binary search
+	std::cout << "\nSpecify the largest benchmark size as a power of two (10-30, 0 to skip): ";
+	int maxPower = 0;
+	std::cin >> maxPower;
+	if (maxPower >= 10 && maxPower <= 30) { benchmark(maxPower); }
+	std::cin.ignore();
+
+	// Exit
+	std::cout << "\nThanks for using this program! Have a great day!\n";
+	std::cout << "Press <Enter> to exit...";
+	std::cin.get();
+	return 0;
+}
@@ -0,0 +1,126 @@
+// Title:   Source file for Static B-Tree
+// Authors: by vezzolter
+// Date:    October 19, 2026
+// ----------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <climits>
+#include "StaticBTree.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <xmmintrin.h>
+#define PREFETCH(addr) _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
+#define POPCOUNT(x) static_cast<int>(__popcnt(x))
+#else
+#define PREFETCH(addr) __builtin_prefetch(addr)
+#define POPCOUNT(x) __builtin_popcount(x)
+#endif
+
+
+// Builds the tree bottom-up: leaves are the sorted keys padded with INT_MAX, and each
+// upper node has B + 1 children, where key j is the largest key of child j
+StaticBTree::StaticBTree(const int arr[], int size) : size(size) {
+    int count = std::max((size + B - 1) / B, 1);
+    nodes.resize(count);
+    offsets.push_back(0);
+    for (int i = 0; i < count * B; i++) {
+        nodes[i / B].keys[i % B] = (i < size) ? arr[i] : INT_MAX;
+    }
+
+    // Largest key of every node in the current layer, the rightmost one is treated as
+    // unbounded, so targets greater than every key still descend into an existing child
+    std::vector<int> maxKeys(count);
+    for (int i = 0; i < count; i++) { maxKeys[i] = nodes[i].keys[B - 1]; }
+    maxKeys[count - 1] = INT_MAX;
+
+    while (count > 1) {
+        int upper = (count + B) / (B + 1);
+        int offset = static_cast<int>(nodes.size());
+        nodes.resize(offset + upper);
+        offsets.push_back(offset);
+
+        std::vector<int> upperMaxKeys(upper);
+        for (int p = 0; p < upper; p++) {
+            for (int j = 0; j < B; j++) {
+                int child = p * (B + 1) + j;
+                nodes[offset + p].keys[j] = (child < count) ? maxKeys[child] : INT_MAX;
+            }
+            upperMaxKeys[p] = maxKeys[std::min(p * (B + 1) + B, count - 1)];
+        }
+
+        maxKeys.swap(upperMaxKeys);
+        count = upper;
+    }
+}
+
+// Number of keys in the node that are less than target, which is also index of a child to descend
+int StaticBTree::rank(const Node& node, int target) {
+#if defined(__AVX2__)
+    __m256i t = _mm256_set1_epi32(target);
+    __m256i lo = _mm256_load_si256(reinterpret_cast<const __m256i*>(node.keys));
+    __m256i hi = _mm256_load_si256(reinterpret_cast<const __m256i*>(node.keys + 8));
+    unsigned int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(t, lo)))
+        | (_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(t, hi))) << 8);
+    return POPCOUNT(mask);
+#else
+    int count = 0;
+    for (int j = 0; j < B; j++) { count += (node.keys[j] < target); }
+    return count;
+#endif
+}
+
+// Index of the first element that is not less than target, or size if there is none
+int StaticBTree::lowerBound(int target) const {
+    int p = 0;
+    for (int h = static_cast<int>(offsets.size()) - 1; h > 0; h--) {
+        p = p * (B + 1) + rank(nodes[offsets[h] + p], target);
+    }
+
+    return std::min(p * B + rank(nodes[p], target), size);
+}
+
+// Index of the first element that is greater than target, or size if there is none
+int StaticBTree::upperBound(int target) const {
+    return (target == INT_MAX) ? size : lowerBound(target + 1);
+}
+
+// Same contract as binary search: index of the target or -1 if it is absent
+int StaticBTree::search(int target) const {
+    int i = lowerBound(target);
+    return (i < size && nodes[i / B].keys[i % B] == target) ? i : -1;
+}
+
+// Number of elements within the closed interval [low, high]
+int StaticBTree::rangeCount(int low, int high) const {
+    if (low > high) { return 0; }
+    return upperBound(high) - lowerBound(low);
+}
+
+// Descends a group of searches level by level, so while one node is being fetched
+// from memory the others are being compared; each child is prefetched in advance
+void StaticBTree::lowerBoundBatch(const int targets[], int count, int results[]) const {
+    const int group = 16;
+    int p[group];
+
+    for (int g = 0; g < count; g += group) {
+        int m = std::min(group, count - g);
+        for (int j = 0; j < m; j++) { p[j] = 0; }
+
+        for (int h = static_cast<int>(offsets.size()) - 1; h > 0; h--) {
+            for (int j = 0; j < m; j++) {
+                p[j] = p[j] * (B + 1) + rank(nodes[offsets[h] + p[j]], targets[g + j]);
+                PREFETCH(&nodes[offsets[h - 1] + p[j]]);
+            }
+        }
+
+        for (int j = 0; j < m; j++) {
+            results[g + j] = std::min(p[j] * B + rank(nodes[p[j]], targets[g + j]), size);
+        }
+    }
+}
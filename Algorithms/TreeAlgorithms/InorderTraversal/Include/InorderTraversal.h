@@ -1,4 +1,4 @@
-// Title:   Header file for Inorder Traversal (Recursive)
+// Title:   Header file for Inorder Traversal (Iterative)
 // Authors: by vezzolter
 // Date:    March 17, 2025
 // ----------------------------------------------------------------------------
@@ -8,6 +8,11 @@
 #define INORDERTRAVERSAL_H
 
 
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+
 struct TreeNode {
     int val;
     TreeNode* left;
@@ -17,6 +22,100 @@ struct TreeNode {
 
 void inorderTraversal(TreeNode* root);
 void reversedInorderTraversal(TreeNode* root);
+void morrisInorderTraversal(TreeNode* root);
+
+
+// --------------
+// Lazy Iteration
+// --------------
+
+// Yields nodes one at a time, keeping on its own stack only the path to the next node,
+// so deep trees can't overflow the call stack; the reversed one goes Right-Root-Left
+class InorderIterator {
+private:
+	std::vector<TreeNode*> path;   // Current node on the top, then its ancestors still to visit
+	bool reversed = false;
+
+	void descend(TreeNode* node);
+
+public:
+	using iterator_category = std::input_iterator_tag;
+	using value_type = TreeNode*;
+	using difference_type = std::ptrdiff_t;
+	using pointer = TreeNode**;
+	using reference = TreeNode*;
+
+	InorderIterator() = default;   // End of any traversal
+	explicit InorderIterator(TreeNode* root, bool reversedOrder = false);
+
+	TreeNode* operator*() const { return path.back(); }
+	InorderIterator& operator++();
+	bool operator==(const InorderIterator& other) const;
+	bool operator!=(const InorderIterator& other) const { return !(*this == other); }
+};
+
+// Range for 'for (TreeNode* node : inorder(root))'
+struct InorderRange {
+	TreeNode* root;
+	bool reversed;
+
+	InorderIterator begin() const { return InorderIterator(root, reversed); }
+	InorderIterator end() const { return InorderIterator(); }
+};
+
+inline InorderRange inorder(TreeNode* root) { return { root, false }; }
+inline InorderRange reversedInorder(TreeNode* root) { return { root, true }; }
+
+
+// --------
+// Visitors
+// --------
+
+// Calls 'visit(node)' for every node, so traversals can be used as building blocks
+template <typename Visitor>
+void inorderTraversal(TreeNode* root, Visitor visit) {
+	for (TreeNode* node : inorder(root)) { visit(node); }
+}
+
+template <typename Visitor>
+void reversedInorderTraversal(TreeNode* root, Visitor visit) {
+	for (TreeNode* node : reversedInorder(root)) { visit(node); }
+}
+
+
+
+// ----------------
+// Morris Traversal
+// ----------------
+
+// Visits nodes without any stack: before going into the left subtree, the rightmost node of it
+// (the predecessor) gets a temporary right link (thread) back to the current node, which leads back
+// up once the subtree is done, and gets removed on the second arrival, restoring the tree;
+// Note: 'visit' must not change links or rely on right links, as some of them are threads until the end
+template <typename Visitor>
+void morrisInorderTraversal(TreeNode* root, Visitor visit) {
+	TreeNode* curr = root;
+	for (; curr; ) {
+		if (!curr->left) {
+			visit(curr);
+			curr = curr->right;   // either the right subtree, or a thread to the successor
+			continue;
+		}
+
+		TreeNode* pred = curr->left;
+		for (; pred->right && pred->right != curr; ) { pred = pred->right; }
+
+		if (!pred->right) {   // first arrival: thread and go left
+			pred->right = curr;
+			curr = curr->left;
+		}
+		else {                // second arrival: left subtree is done
+			pred->right = nullptr;
+			visit(curr);
+			curr = curr->right;
+		}
+	}
+}
 
 
 #endif // INORDERTRAVERSAL_H
\ No newline at end of file
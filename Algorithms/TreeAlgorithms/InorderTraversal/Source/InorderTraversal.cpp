@@ -1,4 +1,4 @@
-// Title:   Source file for Inorder Traversal (Recursive)
+// Title:   Source file for Inorder Traversal (Iterative)
 // Authors: by vezzolter
 // Date:    March 17, 2025
 // ----------------------------------------------------------------------------
@@ -9,15 +9,41 @@
 
 
 void inorderTraversal(TreeNode* root) {
-	if (!root) { return; }
-	inorderTraversal(root->left);
-	std::cout << root->val << " ";
-	inorderTraversal(root->right);
+	inorderTraversal(root, [](TreeNode* node) { std::cout << node->val << " "; });
 }
 
 void reversedInorderTraversal(TreeNode* root) {
-	if (!root) { return; }
-	reversedInorderTraversal(root->right);
-	std::cout << root->val << " ";
-	reversedInorderTraversal(root->left);
+	reversedInorderTraversal(root, [](TreeNode* node) { std::cout << node->val << " "; });
+}
+
+void morrisInorderTraversal(TreeNode* root) {
+	morrisInorderTraversal(root, [](TreeNode* node) { std::cout << node->val << " "; });
+}
+
+
+// --------------
+// Lazy Iteration
+// --------------
+
+InorderIterator::InorderIterator(TreeNode* root, bool reversedOrder) : reversed(reversedOrder) {
+	descend(root);
+}
+
+// Pushes the node and its leftmost descendants (rightmost for the reversed order)
+void InorderIterator::descend(TreeNode* node) {
+	for (; node; node = reversed ? node->right : node->left) { path.push_back(node); }
+}
+
+// The current node has no unvisited left subtree, so the next one is either the first node
+// of its right subtree, or (when there is none) the closest ancestor still on the stack
+InorderIterator& InorderIterator::operator++() {
+	TreeNode* curr = path.back();
+	path.pop_back();
+	descend(reversed ? curr->left : curr->right);
+	return *this;
+}
+
+bool InorderIterator::operator==(const InorderIterator& other) const {
+	if (path.empty() || other.path.empty()) { return path.empty() && other.path.empty(); }
+	return path.back() == other.path.back();
 }
\ No newline at end of file
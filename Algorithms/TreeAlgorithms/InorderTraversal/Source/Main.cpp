@@ -1,16 +1,109 @@
-// Title:   Inorder Traversal Algorithm (Recursive)
+// Title:   Inorder Traversal Algorithm (Iterative)
 // Authors: by vezzolter
 // Date:    March 17, 2025
 // ----------------------------------------------------------------------------
 
 
 #include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstddef>
+#include <new>
 #include "InorderTraversal.h"
 
 
+// Heap bytes in use and their peak, counted by the replaced global allocation functions,
+// which keep the size of every block in front of it
+size_t heapBytes = 0;
+size_t heapPeak = 0;
+
+void* operator new(size_t size) {
+	char* block = static_cast<char*>(std::malloc(size + sizeof(std::max_align_t)));
+	if (!block) { throw std::bad_alloc(); }
+	*reinterpret_cast<size_t*>(block) = size;
+	heapBytes += size;
+	if (heapBytes > heapPeak) { heapPeak = heapBytes; }
+	return block + sizeof(std::max_align_t);
+}
+
+void operator delete(void* pointer) noexcept {
+	if (!pointer) { return; }
+	char* block = static_cast<char*>(pointer) - sizeof(std::max_align_t);
+	heapBytes -= *reinterpret_cast<size_t*>(block);
+	std::free(block);
+}
+
+void operator delete(void* pointer, size_t) noexcept { operator delete(pointer); }
+
+// Runs 'compute' and returns the elapsed milliseconds
+template <typename Compute>
+double milliseconds(Compute compute) {
+	auto start = std::chrono::steady_clock::now();
+	compute();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Builds a tree of values [0, count) inside 'nodes' without recursion, so inorder visits them
+// in ascending order; 'pick' chooses the root of every range of values
+template <typename Pick>
+TreeNode* buildTree(std::vector<TreeNode>& nodes, int count, Pick pick) {
+	struct Range { int low, high; TreeNode** link; };
+	TreeNode* root = nullptr;
+	nodes.clear();
+	nodes.reserve(count);   // no reallocation, so the links stay valid
+	std::vector<Range> ranges = { { 0, count, &root } };
+	for (; !ranges.empty(); ) {
+		Range range = ranges.back();
+		ranges.pop_back();
+		if (range.low >= range.high) { continue; }
+		int value = pick(range.low, range.high);
+		nodes.emplace_back(value);
+		*range.link = &nodes.back();
+		ranges.push_back({ value + 1, range.high, &nodes.back().right });
+		ranges.push_back({ range.low, value, &nodes.back().left });
+	}
+	return root;
+}
+
+// Compares the stack-based traversal with Morris on trees of different shapes: time and
+// the peak of extra heap memory during the traversal
+void benchmark() {
+	std::mt19937 engine(2025);
+	std::vector<TreeNode> nodes;
+	std::cout << std::setw(10) << "Nodes" << std::setw(12) << "Shape" << std::setw(12) << "Stack ms"
+		<< std::setw(12) << "Morris ms" << std::setw(14) << "Stack bytes" << std::setw(14) << "Morris bytes" << std::endl;
+	for (int count : { 1000000, 4000000, 16000000 }) {
+		for (int shape = 0; shape < 3; shape++) {
+			TreeNode* root = nullptr;
+			if (shape == 0) { root = buildTree(nodes, count, [](int low, int high) { return low + (high - low) / 2; }); }
+			else if (shape == 1) { root = buildTree(nodes, count, [&](int low, int high) { return low + static_cast<int>(engine() % (high - low)); }); }
+			else { root = buildTree(nodes, count, [](int low, int high) { return high - low > 1 ? high - 2 : low; }); }   // left spine with right leaves
+
+			uint64_t stackSum = 0, morrisSum = 0;
+			heapPeak = heapBytes;
+			size_t baseline = heapBytes;
+			double stackTime = milliseconds([&]() { inorderTraversal(root, [&](TreeNode* node) { stackSum = stackSum * 31 + node->val; }); });
+			size_t stackBytes = heapPeak - baseline;
+			heapPeak = heapBytes;
+			double morrisTime = milliseconds([&]() { morrisInorderTraversal(root, [&](TreeNode* node) { morrisSum = morrisSum * 31 + node->val; }); });
+			size_t morrisBytes = heapPeak - baseline;
+
+			std::cout << std::setw(10) << count << std::setw(12) << (shape == 0 ? "balanced" : shape == 1 ? "random" : "skewed")
+				<< std::fixed << std::setprecision(2) << std::setw(12) << stackTime << std::setw(12) << morrisTime
+				<< std::setw(14) << stackBytes << std::setw(14) << morrisBytes
+				<< (stackSum == morrisSum ? "   (same)" : "   (different!)") << std::endl;
+		}
+	}
+}
+
 int main() {
 	// Greet
-	std::cout << "\tWelcome to the 'Inorder Traversal (Recursive)' console application!\n";
+	std::cout << "\tWelcome to the 'Inorder Traversal (Iterative)' console application!\n";
 
 	// Manually construct BST
     TreeNode* root = new TreeNode(8);         // level 0
@@ -38,7 +131,47 @@ int main() {
     reversedInorderTraversal(root);
     std::cout << std::endl;
 
-    // Manually lean up memory
+    // Test the version without a stack, which leaves the tree as it was
+    std::cout << "Morris Traversal:\t\t\t";
+    morrisInorderTraversal(root);
+    std::cout << std::endl;
+
+    // Test the traversal as a building block
+    std::vector<int> values;
+    inorderTraversal(root, [&](TreeNode* node) { values.push_back(node->val); });
+    std::cout << "Collected by Visitor:\t\t\t" << values.size() << " values from " << values.front() << " to " << values.back() << std::endl;
+    std::cout << "Three Smallest by Iterator:\t\t";
+    int count = 0;
+    for (TreeNode* node : inorder(root)) {
+        if (count++ == 3) { break; }
+        std::cout << node->val << " ";
+    }
+    std::cout << std::endl;
+
+    // Test a tree far deeper than the call stack allows
+    std::cout << "\nEnter the depth of a degenerate tree (e.g. 1000000): ";
+    int depth = 0;
+    std::cin >> depth;
+    TreeNode* deep = nullptr;
+    for (int i = 0; i < depth; i++) {   // every node is the left child of the next one
+        TreeNode* node = new TreeNode(i);
+        node->left = deep;
+        deep = node;
+    }
+    long long visited = 0;
+    bool sorted = true;
+    inorderTraversal(deep, [&](TreeNode* node) { sorted = sorted && node->val == visited++; });
+    std::cout << "Inorder Traversal visited " << visited << " nodes" << (sorted ? " in ascending order" : " out of order!") << std::endl;
+    visited = 0;
+    morrisInorderTraversal(deep, [&](TreeNode*) { visited++; });
+    std::cout << "Morris Traversal visited " << visited << " nodes without a stack" << std::endl;
+    while (deep) {
+        TreeNode* next = deep->left;
+        delete deep;
+        deep = next;
+    }
+
+    // Manually clean up memory
     delete root->left->left->left;  // left subtree
     delete root->left->left->right;
     delete root->left->left;
@@ -53,9 +186,16 @@ int main() {
     delete root->right;
     delete root;                    // root
 
+	// Compare the stack with Morris
+	std::cout << "\nRun the benchmark? (1 - yes, 0 - no): ";
+	int run = 0;
+	std::cin >> run;
+	if (run == 1) { benchmark(); }
+
 	// Exit
 	std::cout << "\nThanks for using this program! Have a great day!\n";
 	std::cout << "Press <Enter> to exit...";
+	std::cin.ignore();
 	std::cin.get();
 	return 0;
 }
\ No newline at end of file
@@ -8,6 +8,12 @@
 #define LEVELORDERTRAVERSAL_H
 
 
+#include <cstddef>
+#include <iterator>
+#include <queue>
+#include <stack>
+
+
 struct TreeNode {
     int val;
     TreeNode* left;
@@ -19,4 +25,74 @@ void levelorderTraversal(TreeNode* root);
 void reversedLevelorderTraversal(TreeNode* root);
 
 
+// --------------
+// Lazy Iteration
+// --------------
+
+// Yields nodes one at a time, keeping in its queue only discovered nodes, which never span more
+// than two neighbouring levels; only the standard order is lazy, as the reversed one starts from the bottom
+class LevelorderIterator {
+private:
+	std::queue<TreeNode*> discovered;   // Current node in the front
+
+public:
+	using iterator_category = std::input_iterator_tag;
+	using value_type = TreeNode*;
+	using difference_type = std::ptrdiff_t;
+	using pointer = TreeNode**;
+	using reference = TreeNode*;
+
+	LevelorderIterator() = default;   // End of any traversal
+	explicit LevelorderIterator(TreeNode* root);
+
+	TreeNode* operator*() const { return discovered.front(); }
+	LevelorderIterator& operator++();
+	bool operator==(const LevelorderIterator& other) const;
+	bool operator!=(const LevelorderIterator& other) const { return !(*this == other); }
+};
+
+// Range for 'for (TreeNode* node : levelorder(root))'
+struct LevelorderRange {
+	TreeNode* root;
+
+	LevelorderIterator begin() const { return LevelorderIterator(root); }
+	LevelorderIterator end() const { return LevelorderIterator(); }
+};
+
+inline LevelorderRange levelorder(TreeNode* root) { return { root }; }
+
+
+// --------
+// Visitors
+// --------
+
+// Calls 'visit(node)' for every node, so traversals can be used as building blocks
+template <typename Visitor>
+void levelorderTraversal(TreeNode* root, Visitor visit) {
+	for (TreeNode* node : levelorder(root)) { visit(node); }
+}
+
+// Every node is stored before the first one can be visited, taking O(n) extra space
+template <typename Visitor>
+void reversedLevelorderTraversal(TreeNode* root, Visitor visit) {
+	if (!root) { return; }
+
+	std::queue<TreeNode*> q;
+	q.push(root);
+	std::stack<TreeNode*> s;
+
+	for (; !q.empty(); ) {
+		TreeNode* curr = q.front();
+		q.pop();
+
+		s.push(curr);
+
+		if (curr->right) { q.push(curr->right); } // right should be first
+		if (curr->left) { q.push(curr->left); }
+	}
+
+	for (; !s.empty(); s.pop()) { visit(s.top()); }
+}
+
+
 #endif // LEVELORDERTRAVERSAL_H
\ No newline at end of file
@@ -5,47 +5,36 @@
 
 
 #include <iostream>
-#include <queue>
-#include <stack>
 #include "LevelorderTraversal.h"
 
 
 void levelorderTraversal(TreeNode* root) {
-	if (!root) { return; }
-
-	std::queue<TreeNode*> q;
-	q.push(root);
-
-	for (; !q.empty(); ) {
-		TreeNode* curr = q.front();
-		q.pop();
-
-		std::cout << curr->val << " ";
-
-		if (curr->left) { q.push(curr->left); }
-		if (curr->right) { q.push(curr->right); }
-	}
+	levelorderTraversal(root, [](TreeNode* node) { std::cout << node->val << " "; });
 }
 
 void reversedLevelorderTraversal(TreeNode* root) {
-	if (!root) { return; }
+	reversedLevelorderTraversal(root, [](TreeNode* node) { std::cout << node->val << " "; });
+}
 
-	std::queue<TreeNode*> q;
-	q.push(root);
-	std::stack<TreeNode*> s;
 
-	for (; !q.empty(); ) {
-		TreeNode* curr = q.front();
-		q.pop();
+// --------------
+// Lazy Iteration
+// --------------
 
-		s.push(curr);
+LevelorderIterator::LevelorderIterator(TreeNode* root) {
+	if (root) { discovered.push(root); }
+}
 
-		if (curr->right) { q.push(curr->right); } // right should be first
-		if (curr->left) { q.push(curr->left); }
-	}
+// Children join the back of the queue, so they come after the rest of the current level
+LevelorderIterator& LevelorderIterator::operator++() {
+	TreeNode* curr = discovered.front();
+	discovered.pop();
+	if (curr->left) { discovered.push(curr->left); }
+	if (curr->right) { discovered.push(curr->right); }
+	return *this;
+}
 
-	for (; !s.empty(); ) {
-		std::cout << s.top()->val << " ";
-		s.pop();
-	}
+bool LevelorderIterator::operator==(const LevelorderIterator& other) const {
+	if (discovered.empty() || other.discovered.empty()) { return discovered.empty() && other.discovered.empty(); }
+	return discovered.front() == other.discovered.front();
 }
\ No newline at end of file
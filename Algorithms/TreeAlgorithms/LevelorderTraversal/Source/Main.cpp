@@ -38,6 +38,19 @@ int main() {
     reversedLevelorderTraversal(root);
     std::cout << std::endl;
 
+    // Test the traversal as a building block
+    int leaves = 0;
+    levelorderTraversal(root, [&](TreeNode* node) { leaves += !node->left && !node->right; });
+    std::cout << "Leaves Counted by Visitor:\t\t" << leaves << std::endl;
+    std::cout << "Shallowest Leaf by Iterator:\t\t";
+    for (TreeNode* node : levelorder(root)) {
+        if (!node->left && !node->right) {
+            std::cout << node->val;
+            break;
+        }
+    }
+    std::cout << std::endl;
+
     // Manually clean up memory
     delete root->left->left->left;  // left subtree
     delete root->left->left->right;
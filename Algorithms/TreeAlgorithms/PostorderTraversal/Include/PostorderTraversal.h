@@ -1,4 +1,4 @@
-// Title:   Header file for Postorder Traversal (Recursive)
+// Title:   Header file for Postorder Traversal (Iterative)
 // Authors: by vezzolter
 // Date:    March 29, 2025
 // ----------------------------------------------------------------------------
@@ -8,6 +8,11 @@
 #define POSTORDERTRAVERSAL_H
 
 
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+
 struct TreeNode {
     int val;
     TreeNode* left;
@@ -19,4 +24,62 @@ void postorderTraversal(TreeNode* root);
 void reversedPostorderTraversal(TreeNode* root);
 
 
+// --------------
+// Lazy Iteration
+// --------------
+
+// Yields nodes one at a time, keeping on its own stack only the path from the root to the current
+// node, so deep trees can't overflow the call stack; the reversed one goes Right-Left-Root
+class PostorderIterator {
+private:
+	std::vector<TreeNode*> path;   // Current node on the top, then all its ancestors
+	bool reversed = false;
+
+	void descend(TreeNode* node);
+
+public:
+	using iterator_category = std::input_iterator_tag;
+	using value_type = TreeNode*;
+	using difference_type = std::ptrdiff_t;
+	using pointer = TreeNode**;
+	using reference = TreeNode*;
+
+	PostorderIterator() = default;   // End of any traversal
+	explicit PostorderIterator(TreeNode* root, bool reversedOrder = false);
+
+	TreeNode* operator*() const { return path.back(); }
+	PostorderIterator& operator++();
+	bool operator==(const PostorderIterator& other) const;
+	bool operator!=(const PostorderIterator& other) const { return !(*this == other); }
+};
+
+// Range for 'for (TreeNode* node : postorder(root))'
+struct PostorderRange {
+	TreeNode* root;
+	bool reversed;
+
+	PostorderIterator begin() const { return PostorderIterator(root, reversed); }
+	PostorderIterator end() const { return PostorderIterator(); }
+};
+
+inline PostorderRange postorder(TreeNode* root) { return { root, false }; }
+inline PostorderRange reversedPostorder(TreeNode* root) { return { root, true }; }
+
+
+// --------
+// Visitors
+// --------
+
+// Calls 'visit(node)' for every node, so traversals can be used as building blocks
+template <typename Visitor>
+void postorderTraversal(TreeNode* root, Visitor visit) {
+	for (TreeNode* node : postorder(root)) { visit(node); }
+}
+
+template <typename Visitor>
+void reversedPostorderTraversal(TreeNode* root, Visitor visit) {
+	for (TreeNode* node : reversedPostorder(root)) { visit(node); }
+}
+
+
 #endif // POSTORDERTRAVERSAL_H
\ No newline at end of file
@@ -1,16 +1,17 @@
-// Title:   Postorder Traversal Algorithm (Recursive)
+// Title:   Postorder Traversal Algorithm (Iterative)
 // Authors: by vezzolter
 // Date:    March 29, 2025
 // ----------------------------------------------------------------------------
 
 
 #include <iostream>
+#include <unordered_map>
 #include "PostorderTraversal.h"
 
 
 int main() {
 	// Greet
-	std::cout << "\tWelcome to the 'Postorder Traversal (Recursive)' console application!\n";
+	std::cout << "\tWelcome to the 'Postorder Traversal (Iterative)' console application!\n";
 
     // Manually construct BST
     TreeNode* root = new TreeNode(8);         // level 0
@@ -38,6 +39,45 @@ int main() {
     reversedPostorderTraversal(root);
     std::cout << std::endl;
 
+    // Test the traversal as a building block
+    int height = 0;   // children are visited before their parent, so their heights are ready
+    std::unordered_map<TreeNode*, int> heights;
+    postorderTraversal(root, [&](TreeNode* node) {
+        int left = node->left ? heights[node->left] : 0;
+        int right = node->right ? heights[node->right] : 0;
+        heights[node] = 1 + (left > right ? left : right);
+        height = heights[node];
+    });
+    std::cout << "Height by Visitor:\t\t\t" << height << std::endl;
+    std::cout << "First Inner Node by Iterator:\t\t";
+    for (TreeNode* node : postorder(root)) {
+        if (node->left || node->right) {
+            std::cout << node->val;
+            break;
+        }
+    }
+    std::cout << std::endl;
+
+    // Test a tree far deeper than the call stack allows
+    std::cout << "\nEnter the depth of a degenerate tree (e.g. 1000000): ";
+    int depth = 0;
+    std::cin >> depth;
+    TreeNode* deep = nullptr;
+    for (int i = 0; i < depth; i++) {   // every node is a child of the next one, alternating sides
+        TreeNode* node = new TreeNode(i);
+        (i % 2 ? node->left : node->right) = deep;
+        deep = node;
+    }
+    long long visited = 0;
+    bool ordered = true;
+    postorderTraversal(deep, [&](TreeNode* node) { ordered = ordered && node->val == visited++; });
+    std::cout << "Postorder Traversal visited " << visited << " nodes" << (ordered ? " from the bottom up" : " out of order!") << std::endl;
+    while (deep) {
+        TreeNode* next = deep->left ? deep->left : deep->right;
+        delete deep;
+        deep = next;
+    }
+
     // Manually clean up memory
     delete root->left->left->left;  // left subtree
     delete root->left->left->right;
@@ -56,6 +96,7 @@ int main() {
 	// Exit
 	std::cout << "\nThanks for using this program! Have a great day!\n";
 	std::cout << "Press <Enter> to exit...";
+	std::cin.ignore();
 	std::cin.get();
 	return 0;
 }
\ No newline at end of file
@@ -1,4 +1,4 @@
-// Title:   Source file for Postorder Traversal (Recursive)
+// Title:   Source file for Postorder Traversal (Iterative)
 // Authors: by vezzolter
 // Date:    March 29, 2025
 // ----------------------------------------------------------------------------
@@ -9,15 +9,46 @@
 
 
 void postorderTraversal(TreeNode* root) {
-	if (!root) { return; }
-	postorderTraversal(root->left);
-	postorderTraversal(root->right);
-	std::cout << root->val << " ";
+	postorderTraversal(root, [](TreeNode* node) { std::cout << node->val << " "; });
 }
 
 void reversedPostorderTraversal(TreeNode* root) {
-	if (!root) { return; }
-	reversedPostorderTraversal(root->right);
-	reversedPostorderTraversal(root->left);
-	std::cout << root->val << " ";
+	reversedPostorderTraversal(root, [](TreeNode* node) { std::cout << node->val << " "; });
+}
+
+
+// --------------
+// Lazy Iteration
+// --------------
+
+PostorderIterator::PostorderIterator(TreeNode* root, bool reversedOrder) : reversed(reversedOrder) {
+	descend(root);
+}
+
+// Pushes the path to the first node of the subtree, going left whenever possible and right
+// otherwise (the other way round for the reversed order), until a leaf is reached
+void PostorderIterator::descend(TreeNode* node) {
+	for (; node; ) {
+		path.push_back(node);
+		TreeNode* first = reversed ? node->right : node->left;
+		node = first ? first : (reversed ? node->left : node->right);
+	}
+}
+
+// Both subtrees of the current node are done, so it goes to its parent; if the current node was
+// the parent's first child, the parent's second subtree (if any) comes before the parent itself
+PostorderIterator& PostorderIterator::operator++() {
+	TreeNode* curr = path.back();
+	path.pop_back();
+	if (path.empty()) { return *this; }
+	TreeNode* parent = path.back();
+	TreeNode* first = reversed ? parent->right : parent->left;
+	TreeNode* second = reversed ? parent->left : parent->right;
+	if (curr == first && second) { descend(second); }
+	return *this;
+}
+
+bool PostorderIterator::operator==(const PostorderIterator& other) const {
+	if (path.empty() || other.path.empty()) { return path.empty() && other.path.empty(); }
+	return path.back() == other.path.back();
 }
\ No newline at end of file
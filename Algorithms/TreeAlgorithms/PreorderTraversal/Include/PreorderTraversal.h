@@ -1,4 +1,4 @@
-// Title:   Header file for Preorder Traversal (Recursive)
+// Title:   Header file for Preorder Traversal (Iterative)
 // Authors: by vezzolter
 // Date:    March 24, 2025
 // ----------------------------------------------------------------------------
@@ -8,6 +8,11 @@
 #define PREORDERTRAVERSAL_H
 
 
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+
 struct TreeNode {
     int val;
     TreeNode* left;
@@ -17,6 +22,97 @@ struct TreeNode {
 
 void preorderTraversal(TreeNode* root);
 void reversedPreorderTraversal(TreeNode* root);
+void morrisPreorderTraversal(TreeNode* root);
+
+
+// --------------
+// Lazy Iteration
+// --------------
+
+// Yields nodes one at a time, keeping on its own stack the right children still to visit
+// (left ones for the reversed Root-Right-Left order), so deep trees can't overflow the call stack
+class PreorderIterator {
+private:
+	std::vector<TreeNode*> pending;   // Current node on the top, then the subtrees still to visit
+	bool reversed = false;
+
+public:
+	using iterator_category = std::input_iterator_tag;
+	using value_type = TreeNode*;
+	using difference_type = std::ptrdiff_t;
+	using pointer = TreeNode**;
+	using reference = TreeNode*;
+
+	PreorderIterator() = default;   // End of any traversal
+	explicit PreorderIterator(TreeNode* root, bool reversedOrder = false);
+
+	TreeNode* operator*() const { return pending.back(); }
+	PreorderIterator& operator++();
+	bool operator==(const PreorderIterator& other) const;
+	bool operator!=(const PreorderIterator& other) const { return !(*this == other); }
+};
+
+// Range for 'for (TreeNode* node : preorder(root))'
+struct PreorderRange {
+	TreeNode* root;
+	bool reversed;
+
+	PreorderIterator begin() const { return PreorderIterator(root, reversed); }
+	PreorderIterator end() const { return PreorderIterator(); }
+};
+
+inline PreorderRange preorder(TreeNode* root) { return { root, false }; }
+inline PreorderRange reversedPreorder(TreeNode* root) { return { root, true }; }
+
+
+// --------
+// Visitors
+// --------
+
+// Calls 'visit(node)' for every node, so traversals can be used as building blocks
+template <typename Visitor>
+void preorderTraversal(TreeNode* root, Visitor visit) {
+	for (TreeNode* node : preorder(root)) { visit(node); }
+}
+
+template <typename Visitor>
+void reversedPreorderTraversal(TreeNode* root, Visitor visit) {
+	for (TreeNode* node : reversedPreorder(root)) { visit(node); }
+}
+
+
+
+// ----------------
+// Morris Traversal
+// ----------------
+
+// Same threads as in Morris inorder traversal: the rightmost node of the left subtree temporarily
+// links back to the current node, but the node is visited on the first arrival, before threading;
+// Note: 'visit' must not change links or rely on right links, as some of them are threads until the end
+template <typename Visitor>
+void morrisPreorderTraversal(TreeNode* root, Visitor visit) {
+	TreeNode* curr = root;
+	for (; curr; ) {
+		if (!curr->left) {
+			visit(curr);
+			curr = curr->right;   // either the right subtree, or a thread back up
+			continue;
+		}
+
+		TreeNode* pred = curr->left;
+		for (; pred->right && pred->right != curr; ) { pred = pred->right; }
+
+		if (!pred->right) {   // first arrival: visit, thread and go left
+			visit(curr);
+			pred->right = curr;
+			curr = curr->left;
+		}
+		else {                // second arrival: left subtree is done
+			pred->right = nullptr;
+			curr = curr->right;
+		}
+	}
+}
 
 
 #endif // PREORDERTRAVERSAL_H
\ No newline at end of file
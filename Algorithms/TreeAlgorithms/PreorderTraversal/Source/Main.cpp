@@ -1,16 +1,17 @@
-// Title:   Prenorder Traversal Algorithm (Recursive)
+// Title:   Prenorder Traversal Algorithm (Iterative)
 // Authors: by vezzolter
 // Date:    March 24, 2025
 // ----------------------------------------------------------------------------
 
 
 #include <iostream>
+#include <vector>
 #include "PreorderTraversal.h"
 
 
 int main() {
 	// Greet
-	std::cout << "\tWelcome to the 'Preorder Traversal (Recursive)' console application!\n";
+	std::cout << "\tWelcome to the 'Preorder Traversal (Iterative)' console application!\n";
 
     // Manually construct BST
     TreeNode* root = new TreeNode(8);         // level 0
@@ -38,6 +39,47 @@ int main() {
     reversedPreorderTraversal(root);
     std::cout << std::endl;
 
+    // Test the version without a stack, which leaves the tree as it was
+    std::cout << "Morris Traversal:\t\t\t";
+    morrisPreorderTraversal(root);
+    std::cout << std::endl;
+
+    // Test the traversal as a building block
+    std::vector<int> serialized;   // inserting these into an empty BST rebuilds the same tree
+    preorderTraversal(root, [&](TreeNode* node) { serialized.push_back(node->val); });
+    std::cout << "Serialized by Visitor:\t\t\t" << serialized.size() << " values, root first: " << serialized.front() << std::endl;
+    std::cout << "First Leaf by Iterator:\t\t\t";
+    for (TreeNode* node : preorder(root)) {
+        if (!node->left && !node->right) {
+            std::cout << node->val;
+            break;
+        }
+    }
+    std::cout << std::endl;
+
+    // Test a tree far deeper than the call stack allows
+    std::cout << "\nEnter the depth of a degenerate tree (e.g. 1000000): ";
+    int depth = 0;
+    std::cin >> depth;
+    TreeNode* deep = nullptr;
+    for (int i = depth - 1; i >= 0; i--) {   // every node is the right child of the previous one
+        TreeNode* node = new TreeNode(i);
+        node->right = deep;
+        deep = node;
+    }
+    long long visited = 0;
+    bool ordered = true;
+    preorderTraversal(deep, [&](TreeNode* node) { ordered = ordered && node->val == visited++; });
+    std::cout << "Preorder Traversal visited " << visited << " nodes" << (ordered ? " from the root down" : " out of order!") << std::endl;
+    visited = 0;
+    morrisPreorderTraversal(deep, [&](TreeNode*) { visited++; });
+    std::cout << "Morris Traversal visited " << visited << " nodes without a stack" << std::endl;
+    while (deep) {
+        TreeNode* next = deep->right;
+        delete deep;
+        deep = next;
+    }
+
     // Manually clean up memory
     delete root->left->left->left;  // left subtree
     delete root->left->left->right;
@@ -56,6 +98,7 @@ int main() {
 	// Exit
 	std::cout << "\nThanks for using this program! Have a great day!\n";
 	std::cout << "Press <Enter> to exit...";
+	std::cin.ignore();
 	std::cin.get();
 	return 0;
 }
\ No newline at end of file
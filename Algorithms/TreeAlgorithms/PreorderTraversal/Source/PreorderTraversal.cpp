@@ -1,4 +1,4 @@
-// Title:   Source file for Preorder Traversal (Recursive)
+// Title:   Source file for Preorder Traversal (Iterative)
 // Authors: by vezzolter
 // Date:    March 24, 2025
 // ----------------------------------------------------------------------------
@@ -9,15 +9,38 @@
 
 
 void preorderTraversal(TreeNode* root) {
-	if (!root) { return; }
-	std::cout << root->val << " ";
-	preorderTraversal(root->left);
-	preorderTraversal(root->right);
+	preorderTraversal(root, [](TreeNode* node) { std::cout << node->val << " "; });
 }
 
 void reversedPreorderTraversal(TreeNode* root) {
-	if (!root) { return; }
-	std::cout << root->val << " ";
-	reversedPreorderTraversal(root->right);
-	reversedPreorderTraversal(root->left);
+	reversedPreorderTraversal(root, [](TreeNode* node) { std::cout << node->val << " "; });
+}
+
+void morrisPreorderTraversal(TreeNode* root) {
+	morrisPreorderTraversal(root, [](TreeNode* node) { std::cout << node->val << " "; });
+}
+
+
+// --------------
+// Lazy Iteration
+// --------------
+
+PreorderIterator::PreorderIterator(TreeNode* root, bool reversedOrder) : reversed(reversedOrder) {
+	if (root) { pending.push_back(root); }
+}
+
+// Children are pushed in the opposite order, so the first one is visited next
+PreorderIterator& PreorderIterator::operator++() {
+	TreeNode* curr = pending.back();
+	pending.pop_back();
+	TreeNode* first = reversed ? curr->right : curr->left;
+	TreeNode* second = reversed ? curr->left : curr->right;
+	if (second) { pending.push_back(second); }
+	if (first) { pending.push_back(first); }
+	return *this;
+}
+
+bool PreorderIterator::operator==(const PreorderIterator& other) const {
+	if (pending.empty() || other.pending.empty()) { return pending.empty() && other.pending.empty(); }
+	return pending.back() == other.pending.back();
 }
\ No newline at end of file